@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+#include "tip5xx/b_field_accumulator.hpp"
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/serialization.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+void BM_BFieldElementMul(benchmark::State& state) {
+    RandomGenerator rng(1);
+    BFieldElement acc = rng.random_bfe();
+    BFieldElement x = rng.random_bfe();
+    for (auto _ : state) {
+        acc = acc * x;
+        benchmark::DoNotOptimize(acc);
+    }
+}
+BENCHMARK(BM_BFieldElementMul);
+
+void BM_BFieldElementAdd(benchmark::State& state) {
+    RandomGenerator rng(2);
+    BFieldElement acc = rng.random_bfe();
+    BFieldElement x = rng.random_bfe();
+    for (auto _ : state) {
+        acc = acc + x;
+        benchmark::DoNotOptimize(acc);
+    }
+}
+BENCHMARK(BM_BFieldElementAdd);
+
+void BM_BFieldElementMontyred(benchmark::State& state) {
+    RandomGenerator rng(3);
+    __uint128_t x = static_cast<__uint128_t>(rng.random_bfe().raw_u64()) * rng.random_bfe().raw_u64();
+    for (auto _ : state) {
+        uint64_t r = BFieldElement::montyred(x);
+        benchmark::DoNotOptimize(r);
+        x += r;
+    }
+}
+BENCHMARK(BM_BFieldElementMontyred);
+
+void BM_BFieldElementInverse(benchmark::State& state) {
+    RandomGenerator rng(4);
+    BFieldElement x = rng.random_bfe();
+    for (auto _ : state) {
+        x = x.inverse() + BFieldElement::ONE;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_BFieldElementInverse);
+
+void BM_BFieldElementModPow(benchmark::State& state) {
+    RandomGenerator rng(5);
+    BFieldElement x = rng.random_bfe();
+    uint64_t exponent = rng.random_range<uint64_t>(BFieldElement::MAX);
+    for (auto _ : state) {
+        x = x.mod_pow(exponent) + BFieldElement::ONE;
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_BFieldElementModPow);
+
+void BM_BFieldElementBatchInversion(benchmark::State& state) {
+    RandomGenerator rng(6);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> input = rng.random_elements(n);
+    for (auto& e : input) {
+        if (e.is_zero()) {
+            e = BFieldElement::ONE;
+        }
+    }
+
+    for (auto _ : state) {
+        std::vector<BFieldElement> inverses = BFieldElement::batch_inversion(input);
+        benchmark::DoNotOptimize(inverses.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BFieldElementBatchInversion)->RangeMultiplier(4)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+void BM_BFieldElementBatchInversionIntoSpan(benchmark::State& state) {
+    RandomGenerator rng(7);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> input = rng.random_elements(n);
+    std::vector<BFieldElement> output(n);
+
+    for (auto _ : state) {
+        BFieldElement::batch_inversion_or_zero(input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BFieldElementBatchInversionIntoSpan)->RangeMultiplier(4)->Range(1 << 8, 1 << 22)->Unit(benchmark::kMicrosecond);
+
+void BM_BFieldElementCyclicGroupElements(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    BFieldElement generator = BFieldElement::primitive_root_of_unity(n);
+
+    for (auto _ : state) {
+        std::vector<BFieldElement> elements = generator.cyclic_group_elements();
+        benchmark::DoNotOptimize(elements.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BFieldElementCyclicGroupElements)->RangeMultiplier(16)->Range(1 << 8, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+void BM_BFieldElementCosetIntoSpan(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    BFieldElement generator = BFieldElement::primitive_root_of_unity(n);
+    std::vector<BFieldElement> coset(n);
+
+    for (auto _ : state) {
+        generator.cyclic_group_elements_of_order_into(coset, BFieldElement::generator());
+        benchmark::DoNotOptimize(coset.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BFieldElementCosetIntoSpan)->RangeMultiplier(16)->Range(1 << 8, 1 << 24)->Unit(benchmark::kMicrosecond);
+
+void BM_BFieldElementDotProductReduced(benchmark::State& state) {
+    RandomGenerator rng(8);
+    std::vector<BFieldElement> a = rng.random_elements(state.range(0));
+    std::vector<BFieldElement> b = rng.random_elements(state.range(0));
+    for (auto _ : state) {
+        BFieldElement sum = BFieldElement::ZERO;
+        for (size_t i = 0; i < a.size(); i++) {
+            sum += a[i] * b[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BFieldElementDotProductReduced)->Arg(16)->Arg(1 << 12);
+
+void BM_BFieldElementDotProductLazy(benchmark::State& state) {
+    RandomGenerator rng(8);
+    std::vector<BFieldElement> a = rng.random_elements(state.range(0));
+    std::vector<BFieldElement> b = rng.random_elements(state.range(0));
+    for (auto _ : state) {
+        BFieldElement sum = dot_product(a, b);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BFieldElementDotProductLazy)->Arg(16)->Arg(1 << 12);
+
+void BM_BFieldElementDecodePerElement(benchmark::State& state) {
+    RandomGenerator rng(9);
+    std::vector<BFieldElement> values = rng.random_elements(state.range(0));
+    std::vector<std::array<uint8_t, 8>> bytes;
+    for (const auto& v : values) {
+        bytes.push_back(v.raw_bytes());
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < bytes.size(); i++) {
+            values[i] = BFieldElement::from_raw_bytes(bytes[i]);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * BFieldElement::BYTES);
+}
+BENCHMARK(BM_BFieldElementDecodePerElement)->Arg(1 << 16);
+
+void BM_BFieldElementDecodeBulk(benchmark::State& state) {
+    RandomGenerator rng(9);
+    std::vector<BFieldElement> values = rng.random_elements(state.range(0));
+    std::vector<uint8_t> bytes(values.size() * BFieldElement::BYTES);
+    encode_bytes(values, bytes);
+    for (auto _ : state) {
+        DecodeStatus status = decode_bytes(bytes, values);
+        benchmark::DoNotOptimize(status);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * BFieldElement::BYTES);
+}
+BENCHMARK(BM_BFieldElementDecodeBulk)->Arg(1 << 16);
+
+void BM_BFieldElementEncodeBulk(benchmark::State& state) {
+    RandomGenerator rng(9);
+    std::vector<BFieldElement> values = rng.random_elements(state.range(0));
+    std::vector<uint8_t> bytes(values.size() * BFieldElement::BYTES);
+    for (auto _ : state) {
+        encode_bytes(values, bytes);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * BFieldElement::BYTES);
+}
+BENCHMARK(BM_BFieldElementEncodeBulk)->Arg(1 << 16);
+
+std::string decimal_list(size_t n) {
+    RandomGenerator rng(10);
+    std::string text;
+    for (size_t i = 0; i < n; i++) {
+        text += std::to_string(rng.random_bfe().value());
+        text += '\n';
+    }
+    return text;
+}
+
+void BM_BFieldElementParseWithExceptions(benchmark::State& state) {
+    std::string text = decimal_list(state.range(0));
+    std::vector<BFieldElement> out;
+    for (auto _ : state) {
+        out.clear();
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            out.push_back(bfe_from_string(line));
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_BFieldElementParseWithExceptions)->Arg(1 << 16);
+
+void BM_BFieldElementParseList(benchmark::State& state) {
+    std::string text = decimal_list(state.range(0));
+    std::vector<BFieldElement> out;
+    for (auto _ : state) {
+        out.clear();
+        BfeListParseResult result = parse_bfe_list(text, out, 1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_BFieldElementParseList)->Arg(1 << 16);
+
+} // namespace
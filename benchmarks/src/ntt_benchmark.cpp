@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "tip5xx/ntt.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+void BM_NttForward(benchmark::State& state) {
+    RandomGenerator rng(20);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> values = rng.random_elements(n);
+    Ntt::precompute_twiddles(n);
+
+    for (auto _ : state) {
+        Ntt::forward(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_NttForward)->RangeMultiplier(4)->Range(1 << 10, 1 << 22)->Unit(benchmark::kMicrosecond);
+
+void BM_NttForwardSingleThread(benchmark::State& state) {
+    RandomGenerator rng(21);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> values = rng.random_elements(n);
+    Ntt::precompute_twiddles(n);
+
+    for (auto _ : state) {
+        Ntt::forward(values, 1);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_NttForwardSingleThread)->Arg(1 << 16)->Arg(1 << 18)->Arg(1 << 20)->Arg(1 << 22)->Unit(benchmark::kMicrosecond);
+
+void BM_NttLowDegreeExtension(benchmark::State& state) {
+    RandomGenerator rng(22);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> evaluations = rng.random_elements(n);
+
+    for (auto _ : state) {
+        std::vector<BFieldElement> extended = Ntt::low_degree_extension(evaluations, 4, BFieldElement::generator());
+        benchmark::DoNotOptimize(extended.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_NttLowDegreeExtension)->Arg(1 << 16)->Arg(1 << 18)->Unit(benchmark::kMicrosecond);
+
+} // namespace
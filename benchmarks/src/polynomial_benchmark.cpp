@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "tip5xx/polynomial.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+using BPolynomial = Polynomial<BFieldElement>;
+
+BPolynomial random_polynomial(RandomGenerator& rng, size_t num_coefficients) {
+    return BPolynomial(rng.random_elements(num_coefficients));
+}
+
+template <BPolynomial (*Multiply)(const BPolynomial&, const BPolynomial&)>
+void BM_PolynomialMultiply(benchmark::State& state) {
+    RandomGenerator rng(30);
+    size_t n = static_cast<size_t>(state.range(0));
+    BPolynomial a = random_polynomial(rng, n);
+    BPolynomial b = random_polynomial(rng, n);
+    for (auto _ : state) {
+        BPolynomial c = Multiply(a, b);
+        benchmark::DoNotOptimize(c.coefficients().data());
+    }
+}
+BENCHMARK_TEMPLATE(BM_PolynomialMultiply, BPolynomial::naive_multiply)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_PolynomialMultiply, BPolynomial::karatsuba_multiply)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_PolynomialMultiply, BPolynomial::ntt_multiply)->RangeMultiplier(2)->Range(16, 1 << 16);
+
+void BM_PolynomialDivide(benchmark::State& state) {
+    RandomGenerator rng(31);
+    size_t n = static_cast<size_t>(state.range(0));
+    BPolynomial dividend = random_polynomial(rng, 2 * n);
+    BPolynomial divisor = random_polynomial(rng, n);
+    for (auto _ : state) {
+        auto result = dividend.divide(divisor);
+        benchmark::DoNotOptimize(result.second.coefficients().data());
+    }
+}
+BENCHMARK(BM_PolynomialDivide)->RangeMultiplier(4)->Range(64, 1 << 14);
+
+void BM_PolynomialBatchEvaluate(benchmark::State& state) {
+    RandomGenerator rng(32);
+    size_t n = static_cast<size_t>(state.range(0));
+    BPolynomial p = random_polynomial(rng, n);
+    std::vector<BFieldElement> xs = rng.random_elements(n);
+    for (auto _ : state) {
+        std::vector<BFieldElement> values = p.batch_evaluate(xs);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_PolynomialBatchEvaluate)->RangeMultiplier(4)->Range(256, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+void BM_PolynomialInterpolate(benchmark::State& state) {
+    RandomGenerator rng(33);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> xs = rng.random_elements(n);
+    std::vector<BFieldElement> ys = rng.random_elements(n);
+    for (auto _ : state) {
+        BPolynomial p = BPolynomial::interpolate(xs, ys);
+        benchmark::DoNotOptimize(p.coefficients().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_PolynomialInterpolate)->RangeMultiplier(4)->Range(256, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+void BM_PolynomialBarycentricEvaluate(benchmark::State& state) {
+    RandomGenerator rng(34);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<BFieldElement> codeword = rng.random_elements(n);
+    BFieldElement x = rng.random_bfe();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BPolynomial::barycentric_evaluate(codeword, x));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_PolynomialBarycentricEvaluate)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <benchmark/benchmark.h>
+#include <future>
+#include <vector>
+#include "tip5xx/hash_service.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "tip5xx/tip5xx.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+// Byte-oriented Tip5
+
+void BM_Tip5HashPair(benchmark::State& state) {
+    std::vector<uint8_t> left(32, 0x11);
+    std::vector<uint8_t> right(32, 0x22);
+    for (auto _ : state) {
+        std::vector<uint8_t> hash = Tip5::hash_pair(left, right);
+        benchmark::DoNotOptimize(hash.data());
+    }
+}
+BENCHMARK(BM_Tip5HashPair);
+
+void BM_Tip5HashPairIntoArray(benchmark::State& state) {
+    std::vector<uint8_t> left(32, 0x11);
+    std::vector<uint8_t> right(32, 0x22);
+    Tip5::Hash hash;
+    for (auto _ : state) {
+        Tip5::hash_pair(left, right, hash);
+        benchmark::DoNotOptimize(hash.data());
+    }
+}
+BENCHMARK(BM_Tip5HashPairIntoArray);
+
+void BM_Tip5Permute(benchmark::State& state) {
+    Tip5::State sponge_state{};
+    for (auto _ : state) {
+        Tip5::permute(sponge_state);
+        benchmark::DoNotOptimize(sponge_state.data());
+    }
+}
+BENCHMARK(BM_Tip5Permute);
+
+void BM_Tip5HashVarlen(benchmark::State& state) {
+    std::vector<std::vector<uint8_t>> inputs(static_cast<size_t>(state.range(0)), std::vector<uint8_t>(8, 0x33));
+    for (auto _ : state) {
+        std::vector<uint8_t> hash = Tip5::hash_varlen(inputs);
+        benchmark::DoNotOptimize(hash.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Tip5HashVarlen)->RangeMultiplier(4)->Range(1, 256);
+
+// Field-native Tip5
+
+void BM_Tip5SpongeHashPair(benchmark::State& state) {
+    RandomGenerator rng(10);
+    Digest left = rng.random_digest();
+    Digest right = rng.random_digest();
+    for (auto _ : state) {
+        left = Tip5Sponge::hash_pair(left, right);
+        benchmark::DoNotOptimize(left);
+    }
+}
+BENCHMARK(BM_Tip5SpongeHashPair);
+
+void BM_Tip5SpongePermutation(benchmark::State& state) {
+    Tip5Sponge sponge = Tip5Sponge::init();
+    for (auto _ : state) {
+        sponge.permutation();
+        benchmark::DoNotOptimize(sponge.state().data());
+    }
+}
+BENCHMARK(BM_Tip5SpongePermutation);
+
+void BM_Tip5SpongeHashVarlen(benchmark::State& state) {
+    RandomGenerator rng(11);
+    std::vector<BFieldElement> input = rng.random_elements(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Digest digest = Tip5Sponge::hash_varlen(input);
+        benchmark::DoNotOptimize(digest);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Tip5SpongeHashVarlen)->RangeMultiplier(4)->Range(1, 4096);
+
+void BM_Tip5SpongeHashPairs(benchmark::State& state) {
+    RandomGenerator rng(12);
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Digest> lefts(n);
+    std::vector<Digest> rights(n);
+    std::vector<Digest> out(n);
+    for (size_t i = 0; i < n; i++) {
+        lefts[i] = rng.random_digest();
+        rights[i] = rng.random_digest();
+    }
+    for (auto _ : state) {
+        Tip5Sponge::hash_pairs(lefts, rights, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Tip5SpongeHashPairs)->Arg(8)->Arg(1024);
+
+// Requests in flight per client, submitted before waiting for them
+void BM_HashServiceHashPair(benchmark::State& state) {
+    static HashService service;
+    RandomGenerator rng(13 + static_cast<uint64_t>(state.thread_index()));
+    Digest left = rng.random_digest();
+    Digest right = rng.random_digest();
+    size_t in_flight = static_cast<size_t>(state.range(0));
+    std::vector<std::future<Digest>> futures(in_flight);
+    for (auto _ : state) {
+        for (auto& future : futures) {
+            future = service.hash_pair(left, right);
+        }
+        for (auto& future : futures) {
+            benchmark::DoNotOptimize(future.get());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_HashServiceHashPair)->Arg(1)->Arg(256)->Threads(1)->Threads(4)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "b_field_element.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Unreduced sum of BFieldElement products.
+ *
+ * Montgomery products are added as full 128-bit values into a 192-bit
+ * accumulator, and a single Montgomery reduction at the end yields the field
+ * element. A sum of k products costs k widening multiplications and one
+ * reduction instead of k reductions and k modular additions. The accumulator
+ * cannot overflow for fewer than 2^64 terms.
+ */
+class BFieldAccumulator {
+public:
+    constexpr BFieldAccumulator() = default;
+
+    // acc += a * b
+    constexpr void mul_add(const BFieldElement& a, const BFieldElement& b) {
+        add_u128(static_cast<__uint128_t>(a.raw_u64()) * b.raw_u64());
+    }
+
+    // acc += a; a Montgomery value v is the reduction of v · 2^64
+    constexpr void add(const BFieldElement& a) {
+        add_u128(static_cast<__uint128_t>(a.raw_u64()) << 64);
+    }
+
+    // The accumulated sum as a field element
+    constexpr BFieldElement reduce() const {
+        // value = (high · 2^64 + mid) · 2^64 + low, and the top 128 bits are
+        // folded below P so the final reduction sees a valid Montgomery input
+        uint64_t mid = static_cast<uint64_t>(low_ >> 64);
+        uint64_t folded = BFieldElement::mod_reduce((static_cast<__uint128_t>(high_) << 64) | mid);
+        if (folded >= BFieldElement::P) {
+            folded -= BFieldElement::P;
+        }
+        __uint128_t value = (static_cast<__uint128_t>(folded) << 64) | static_cast<uint64_t>(low_);
+        return BFieldElement::from_raw_u64(BFieldElement::montyred(value));
+    }
+
+    constexpr void reset() {
+        low_ = 0;
+        high_ = 0;
+    }
+
+private:
+    constexpr void add_u128(__uint128_t x) {
+        low_ += x;
+        high_ += low_ < x ? 1 : 0;
+    }
+
+    __uint128_t low_ = 0;
+    uint64_t high_ = 0;
+};
+
+// Σ a[i] · b[i] with one reduction; throws std::invalid_argument if lengths differ
+BFieldElement dot_product(span<const BFieldElement> a, span<const BFieldElement> b);
+
+// y[i] += alpha · x[i]; throws std::invalid_argument if lengths differ
+void axpy(BFieldElement alpha, span<const BFieldElement> x, span<BFieldElement> y);
+
+// out[i] = Σ_k coefficients[k] · vectors[k][i], one reduction per output.
+// Every vector must have out.size() elements and there must be one coefficient
+// per vector; throws std::invalid_argument otherwise.
+void linear_combination(span<const span<const BFieldElement>> vectors,
+                        span<const BFieldElement> coefficients,
+                        span<BFieldElement> out);
+
+} // namespace tip5xx
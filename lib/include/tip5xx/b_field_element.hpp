@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <charconv>
 #include <climits>
 #include <cmath>
 #include <cstdint>
@@ -32,7 +33,8 @@
 #include <limits>
 #include <sstream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <system_error>
 #include <vector>
 #include "traits.hpp"
 
@@ -54,7 +56,15 @@ public:
     using FiniteField<BFieldElement>::inverse;
     using FiniteField<BFieldElement>::inverse_or_zero;
     using FiniteField<BFieldElement>::batch_inversion;
+    using FiniteField<BFieldElement>::batch_inversion_in_place;
+    using FiniteField<BFieldElement>::batch_inversion_or_zero;
+    using FiniteField<BFieldElement>::batch_inversion_or_zero_in_place;
     using FiniteField<BFieldElement>::cyclic_group_elements;
+    using FiniteField<BFieldElement>::cyclic_group_elements_into;
+    using FiniteField<BFieldElement>::cyclic_group_elements_of_order;
+    using FiniteField<BFieldElement>::cyclic_group_elements_of_order_into;
+    using FiniteField<BFieldElement>::powers_into;
+    using FiniteField<BFieldElement>::power_of_two_order;
     using FiniteField<BFieldElement>::primitive_root_of_unity;
     using FiniteField<BFieldElement>::mod_pow_u64;
     using FiniteField<BFieldElement>::mod_pow_u32;
@@ -70,6 +80,7 @@ public:
     static constexpr uint64_t R2 = 0xFFFFFFFE00000001ULL;
 
     // -2^-1
+    // The constants are defined constexpr after the class, so they are constant-initialized
     static const BFieldElement MINUS_TWO_INVERSE;
 
     // Constants
@@ -77,7 +88,7 @@ public:
     static const BFieldElement ONE;
 
     // Constructors
-    BFieldElement() : value_(0) {}
+    constexpr BFieldElement() : value_(0) {}
 
     // Main constructor - converts to Montgomery form
     static constexpr BFieldElement new_element(uint64_t value) {
@@ -95,7 +106,9 @@ public:
     // Implementation of Inverse trait
     BFieldElement inverse_impl() const;
 
-    // Power accumulator function
+    // Power accumulator function: result[j] = base[j]^(2^M) · tail[j]. Kept
+    // inline and scalar: for the small N it is used with, a call into the
+    // packed kernels costs more than it saves.
     template<size_t N, size_t M>
     static std::array<BFieldElement, N> power_accumulator(
         const std::array<BFieldElement, N>& base,
@@ -128,7 +141,10 @@ public:
     }
 
     // Implementation of PrimitiveRootOfUnity trait
-    static BFieldElement primitive_root_of_unity_impl(uint64_t n);
+    static constexpr BFieldElement primitive_root_of_unity_impl(uint64_t n);
+
+    // log2 of the largest order for which a primitive root of unity exists
+    static constexpr size_t MAX_TWO_ADICITY = 32;
 
     // Implementation of ModPowU64 trait
     BFieldElement mod_pow_u64_impl(uint64_t exp) const;
@@ -140,8 +156,8 @@ public:
     std::vector<BFieldElement> cyclic_group_elements_impl(size_t max = 0) const;
 
     // Static methods required by FiniteField
-    static BFieldElement zero() { return ZERO; }
-    static BFieldElement one() { return ONE; }
+    static constexpr BFieldElement zero() { return BFieldElement(); }
+    static constexpr BFieldElement one() { return new_element(1UL); }
 
     // Lift to XFieldElement
     XFieldElement lift() const;
@@ -155,11 +171,18 @@ public:
         *this -= ONE;
     }
 
-    // Montgomery exponentiation
+    // Montgomery exponentiation, left-to-right with a sliding window of odd powers
     BFieldElement mod_pow(uint64_t exp) const;
     BFieldElement mod_pow_u32(uint32_t exp) const;
     BFieldElement mod_pow_u64(uint64_t exp) const;
 
+    // Power with an exponent fixed at compile time; unrolls into straight-line
+    // square-and-multiply code, e.g. four multiplications for pow<7>()
+    template <uint64_t E>
+    constexpr BFieldElement pow() const {
+        return BFieldElement(raw_pow<E>(value_));
+    }
+
     // Montgomery reduction
     // Verification correction factor
     static_assert(1 + ~BFieldElement::P == 0x00000000FFFFFFFFULL, "Correction factor calculation is incorrect");
@@ -229,11 +252,11 @@ public:
         return static_cast<__uint128_t>(value_);
     }
 
-    static BFieldElement from_raw_u64(uint64_t e) {
+    static constexpr BFieldElement from_raw_u64(uint64_t e) {
         return BFieldElement(e);
     }
 
-    uint64_t raw_u64() const {
+    constexpr uint64_t raw_u64() const {
         return value_;
     }
 
@@ -371,13 +394,91 @@ private:
         return montyred(static_cast<__uint128_t>(value_));
     }
 
-    // Internal exponentiation helper
-    static BFieldElement exp(BFieldElement base, uint64_t exponent);
+    // Raw Montgomery-form helpers that avoid constructing intermediate elements
+    static constexpr uint64_t raw_mul(uint64_t a, uint64_t b) {
+        return montyred(static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b));
+    }
+
+    // x^(2^n)
+    static constexpr uint64_t raw_square_n(uint64_t x, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            x = raw_mul(x, x);
+        }
+        return x;
+    }
 
-    // Primitive roots lookup table
-    static const std::unordered_map<uint64_t, uint64_t> PRIMITIVE_ROOTS;
+    template <uint64_t E>
+    static constexpr uint64_t raw_pow(uint64_t x) {
+        if constexpr (E == 0) {
+            return new_element(1UL).value_;
+        } else if constexpr (E == 1) {
+            return x;
+        } else {
+            uint64_t half = raw_pow<E / 2>(x);
+            uint64_t square = raw_mul(half, half);
+            if constexpr ((E & 1) != 0) {
+                return raw_mul(square, x);
+            } else {
+                return square;
+            }
+        }
+    }
+
+    // Primitive roots of unity of order 2^k, indexed by k
+    static const std::array<BFieldElement, MAX_TWO_ADICITY + 1> PRIMITIVE_ROOTS;
 };
 
+inline constexpr BFieldElement BFieldElement::ZERO = BFieldElement::new_element(0UL);
+inline constexpr BFieldElement BFieldElement::ONE = BFieldElement::new_element(1UL);
+inline constexpr BFieldElement BFieldElement::MINUS_TWO_INVERSE = BFieldElement::new_element(0x7FFFFFFF80000000);
+
+inline constexpr std::array<BFieldElement, BFieldElement::MAX_TWO_ADICITY + 1> BFieldElement::PRIMITIVE_ROOTS = {
+    BFieldElement::new_element(1ULL),
+    BFieldElement::new_element(18446744069414584320ULL),
+    BFieldElement::new_element(281474976710656ULL),
+    BFieldElement::new_element(18446744069397807105ULL),
+    BFieldElement::new_element(17293822564807737345ULL),
+    BFieldElement::new_element(70368744161280ULL),
+    BFieldElement::new_element(549755813888ULL),
+    BFieldElement::new_element(17870292113338400769ULL),
+    BFieldElement::new_element(13797081185216407910ULL),
+    BFieldElement::new_element(1803076106186727246ULL),
+    BFieldElement::new_element(11353340290879379826ULL),
+    BFieldElement::new_element(455906449640507599ULL),
+    BFieldElement::new_element(17492915097719143606ULL),
+    BFieldElement::new_element(1532612707718625687ULL),
+    BFieldElement::new_element(16207902636198568418ULL),
+    BFieldElement::new_element(17776499369601055404ULL),
+    BFieldElement::new_element(6115771955107415310ULL),
+    BFieldElement::new_element(12380578893860276750ULL),
+    BFieldElement::new_element(9306717745644682924ULL),
+    BFieldElement::new_element(18146160046829613826ULL),
+    BFieldElement::new_element(3511170319078647661ULL),
+    BFieldElement::new_element(17654865857378133588ULL),
+    BFieldElement::new_element(5416168637041100469ULL),
+    BFieldElement::new_element(16905767614792059275ULL),
+    BFieldElement::new_element(9713644485405565297ULL),
+    BFieldElement::new_element(5456943929260765144ULL),
+    BFieldElement::new_element(17096174751763063430ULL),
+    BFieldElement::new_element(1213594585890690845ULL),
+    BFieldElement::new_element(6414415596519834757ULL),
+    BFieldElement::new_element(16116352524544190054ULL),
+    BFieldElement::new_element(9123114210336311365ULL),
+    BFieldElement::new_element(4614640910117430873ULL),
+    BFieldElement::new_element(1753635133440165772ULL),
+};
+
+// Orders are powers of two (or 0, treated like 1), so the table is indexed by countr_zero(n)
+constexpr BFieldElement BFieldElement::primitive_root_of_unity_impl(uint64_t n) {
+    if (n <= 1) {
+        return PRIMITIVE_ROOTS[0];
+    }
+    if ((n & (n - 1)) != 0 || static_cast<size_t>(__builtin_ctzll(n)) > MAX_TWO_ADICITY) {
+        throw BFieldElementPrimitiveRootError();
+    }
+    return PRIMITIVE_ROOTS[static_cast<size_t>(__builtin_ctzll(n))];
+}
+
 // Stream operators
 std::ostream& operator<<(std::ostream& os, const BFieldElement& bfe);
 std::istream& operator>>(std::istream& is, BFieldElement& bfe);
@@ -386,6 +487,35 @@ std::istream& operator>>(std::istream& is, BFieldElement& bfe);
 BFieldElement bfe_from_string(const std::string& str);
 BFieldElement bfe_from_hex_string(const std::string& str);
 
+// Non-throwing parsing in the style of std::from_chars. Base 10 accepts an
+// optional '-' followed by digits whose magnitude is below P, base 16 accepts
+// hex digits below 2^127 reduced modulo P, like bfe_from_hex_string. No
+// whitespace, sign or prefix is skipped otherwise. On success ptr points past
+// the last digit; on failure value is untouched and ec is invalid_argument
+// (no digits) or result_out_of_range.
+std::from_chars_result bfe_from_chars(const char* first, const char* last, BFieldElement& value, int base = 10);
+
+// Like bfe_from_string, but reports errors as an error code. The grammar is
+// the same except that a lone sign ("-" or "+"), which bfe_from_string reads
+// as zero, is invalid_argument.
+std::errc bfe_parse(std::string_view text, BFieldElement& value);
+
+// Outcome of parse_bfe_list
+struct BfeListParseResult {
+    std::errc ec = std::errc();
+    size_t error_offset = 0;  // Offset of the offending token in the text on failure
+    size_t parsed = 0;        // Elements appended to the output
+
+    bool ok() const { return ec == std::errc(); }
+};
+
+// Parse elements separated by commas and/or whitespace, including newlines,
+// and append them to out; empty fields are skipped. Each element is a signed
+// decimal or a 0x-prefixed hex number as accepted by bfe_parse. Large inputs
+// are split at line breaks and parsed on up to num_threads threads (0 uses
+// default_thread_count()). On failure nothing is appended.
+BfeListParseResult parse_bfe_list(std::string_view text, std::vector<BFieldElement>& out, size_t num_threads = 0);
+
 // Macros to simplify creation
 #define bfe(x) BFieldElement::new_element(x)
 #define bfe_vec(...) createBfeVec(__VA_ARGS__)
@@ -395,6 +525,10 @@ BFieldElement bfe_from_hex_string(const std::string& str);
 template<typename... Args>
 std::vector<BFieldElement> createBfeVec(Args... args);
 
+// createBfeVec with storage from the given allocator
+template<typename Alloc, typename... Args>
+std::vector<BFieldElement, Alloc> createBfeVecWith(const Alloc& alloc, Args... args);
+
 template<size_t N, typename... Args>
 std::array<BFieldElement, N> createBfeArray(Args... args);
 
@@ -443,4 +577,26 @@ bool try_bfe_to(const BFieldElement& bfe, T& output) {
     }
 }
 
+template<typename... Args>
+std::vector<BFieldElement> createBfeVec(Args... args) {
+    return createBfeVecWith(std::allocator<BFieldElement>(), args...);
+}
+
+template<typename Alloc, typename... Args>
+std::vector<BFieldElement, Alloc> createBfeVecWith(const Alloc& alloc, Args... args) {
+    std::vector<BFieldElement, Alloc> result(alloc);
+    result.reserve(sizeof...(Args));
+    (result.push_back(bfe_from(args)), ...);
+    return result;
+}
+
+template<size_t N, typename... Args>
+std::array<BFieldElement, N> createBfeArray(Args... args) {
+    static_assert(sizeof...(Args) <= N, "bfe_array: more values than elements");
+    std::array<BFieldElement, N> result{};
+    size_t i = 0;
+    ((result[i++] = bfe_from(args)), ...);
+    return result;
+}
+
 } // namespace tip5xx
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "b_field_element.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+// Instruction set used by the packed BFieldElement kernels
+enum class SimdKernel {
+    Scalar,
+    AVX2,    // 4 elements per vector
+    AVX512,  // 8 elements per vector
+    NEON     // 2 elements per vector
+};
+
+/**
+ * Element-wise BFieldElement arithmetic over whole arrays.
+ *
+ * The widest kernel supported by the CPU is selected at runtime on first use;
+ * the scalar kernel is used everywhere else. All outputs are identical to the
+ * corresponding BFieldElement operators. Outputs may alias inputs.
+ *
+ * These are array-level kernels used by bulk serialization; per-element
+ * code such as BFieldElement::power_accumulator and the Tip5Sponge rounds
+ * stays scalar, where a call per small batch would cost more than it saves.
+ */
+class BFieldElementSimd {
+public:
+    // Kernel selected for this CPU
+    static SimdKernel active_kernel();
+
+    // Whether a kernel was compiled in and is supported by this CPU
+    static bool is_supported(SimdKernel kernel);
+
+    static const char* kernel_name(SimdKernel kernel);
+
+    // out[i] = a[i] op b[i]; throws std::invalid_argument if lengths differ
+    static void add(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+    static void sub(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+    static void mul(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+
+    // out[i] = BFieldElement::montyred(x[i])
+    static void montyred(span<const __uint128_t> x, span<uint64_t> out);
+
+    // Same operations with an explicitly chosen kernel; throws std::invalid_argument
+    // if the kernel is not supported
+    static void add(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+    static void sub(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+    static void mul(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out);
+    static void montyred(SimdKernel kernel, span<const __uint128_t> x, span<uint64_t> out);
+
+    // Kernels on raw Montgomery representations, n elements each
+    static void add_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+    static void sub_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+    static void mul_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n);
+};
+
+} // namespace tip5xx
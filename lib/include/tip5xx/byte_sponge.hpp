@@ -0,0 +1,193 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "instrumentation.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+namespace detail {
+
+// Round constants of the byte permutation, one per round
+inline constexpr std::array<uint8_t, 80> BYTE_ROUND_CONSTANTS = {
+    0x01, 0x82, 0x83, 0x04, 0x85, 0x06, 0x07, 0x88,
+    0x89, 0x0A, 0x8B, 0x0C, 0x8D, 0x0E, 0x0F, 0x90,
+    0x91, 0x12, 0x93, 0x14, 0x95, 0x16, 0x17, 0x98,
+    0x99, 0x1A, 0x9B, 0x1C, 0x9D, 0x1E, 0x1F, 0xA0,
+    0xA1, 0x22, 0xA3, 0x24, 0xA5, 0x26, 0x27, 0xA8,
+    0xA9, 0x2A, 0xAB, 0x2C, 0xAD, 0x2E, 0x2F, 0xB0,
+    0xB1, 0x32, 0xB3, 0x34, 0xB5, 0x36, 0x37, 0xB8,
+    0xB9, 0x3A, 0xBB, 0x3C, 0xBD, 0x3E, 0x3F, 0xC0,
+    0xC1, 0x42, 0xC3, 0x44, 0xC5, 0x46, 0x47, 0xC8,
+    0xC9, 0x4A, 0xCB, 0x4C, 0xCD, 0x4E, 0x4F, 0xD0
+};
+
+constexpr uint8_t rotl8(uint8_t x, unsigned int n) {
+    return static_cast<uint8_t>((x << n) | (x >> (8 - n)));
+}
+
+// S-box x ← (x + (x ≪ 2)) ⊕ (x ≫ 1)
+constexpr uint8_t byte_sbox(uint8_t x) {
+    x = static_cast<uint8_t>(x + rotl8(x, 2));
+    return static_cast<uint8_t>(x ^ (x >> 1));
+}
+
+constexpr uint8_t byte_mix(uint8_t prev, uint8_t curr, uint8_t next) {
+    return static_cast<uint8_t>(curr ^ rotl8(prev, 1) ^ rotl8(next, 2));
+}
+
+} // namespace detail
+
+/**
+ * The byte permutation of Tip5 for a state of StateSize bytes and Rounds rounds.
+ *
+ * Each round adds the round constant to byte 0, applies the S-box to every
+ * byte and mixes each byte with its cyclic neighbours. Rounds are expanded at
+ * compile time with their constants, the wrap-around neighbours of the first
+ * and last byte are peeled off so the remaining bytes form fixed-length loops
+ * without index arithmetic, which the compiler vectorizes, and rounds
+ * alternate between two buffers so no copy is needed between them.
+ */
+template <size_t StateSize, size_t Rounds>
+class BytePermutation {
+public:
+    static_assert(StateSize >= 3, "The mixing layer needs three distinct neighbours");
+    static_assert(Rounds >= 1 && Rounds <= detail::BYTE_ROUND_CONSTANTS.size(),
+                  "Round constants are defined for up to 80 rounds");
+
+    static constexpr size_t STATE_SIZE = StateSize;
+    static constexpr size_t ROUNDS = Rounds;
+
+    using State = std::array<uint8_t, StateSize>;
+
+    static void permute(State& state) { permute(state.data()); }
+
+    static void permute(uint8_t* state) {
+        TIP5XX_COUNT(byte_permutations, 1);
+        alignas(64) uint8_t other[StateSize];
+        round_pairs(state, other, std::make_index_sequence<Rounds / 2>());
+        if constexpr (Rounds % 2 == 1) {
+            round<Rounds - 1>(state, other);
+            std::memcpy(state, other, StateSize);
+        }
+    }
+
+private:
+    template <size_t Round>
+    static void round(const uint8_t* in, uint8_t* out) {
+        uint8_t s[StateSize];
+        for (size_t i = 0; i < StateSize; ++i) {
+            s[i] = detail::byte_sbox(in[i]);
+        }
+        s[0] = detail::byte_sbox(static_cast<uint8_t>(in[0] ^ detail::BYTE_ROUND_CONSTANTS[Round]));
+
+        out[0] = detail::byte_mix(s[StateSize - 1], s[0], s[1]);
+        for (size_t i = 1; i < StateSize - 1; ++i) {
+            out[i] = detail::byte_mix(s[i - 1], s[i], s[i + 1]);
+        }
+        out[StateSize - 1] = detail::byte_mix(s[StateSize - 2], s[StateSize - 1], s[0]);
+    }
+
+    template <size_t... P>
+    static void round_pairs([[maybe_unused]] uint8_t* state, [[maybe_unused]] uint8_t* other,
+                            std::index_sequence<P...>) {
+        ((round<2 * P>(state, other), round<2 * P + 1>(other, state)), ...);
+    }
+};
+
+/**
+ * Byte-oriented Tip5 sponge with its parameters fixed at compile time.
+ *
+ * Tip5 is ByteSponge<63, 31, 80, 32>; other instantiations, e.g. a wider
+ * state and rate for hashing bulk data, share the construction: inputs are
+ * XORed into the first Rate bytes and permuted a block at a time, and the
+ * output is squeezed Rate bytes per permutation.
+ */
+template <size_t StateSize, size_t Rate, size_t Rounds, size_t HashSize = 32>
+class ByteSponge {
+public:
+    static_assert(Rate >= 1 && Rate < StateSize, "Rate must leave a non-empty capacity");
+
+    static constexpr size_t STATE_SIZE = StateSize;
+    static constexpr size_t RATE = Rate;
+    static constexpr size_t CAPACITY = StateSize - Rate;
+    static constexpr size_t ROUNDS = Rounds;
+    static constexpr size_t HASH_SIZE = HashSize;
+
+    using Permutation = BytePermutation<StateSize, Rounds>;
+    using State = std::array<uint8_t, StateSize>;
+    using Hash = std::array<uint8_t, HashSize>;
+
+    static void permute(State& state) { Permutation::permute(state.data()); }
+
+    // XOR the input into the rate and permute, a block at a time
+    static void absorb(State& state, const uint8_t* data, size_t len) {
+        size_t absorbed = 0;
+        while (absorbed < len) {
+            size_t to_absorb = std::min(Rate, len - absorbed);
+            for (size_t i = 0; i < to_absorb; ++i) {
+                state[i] ^= data[absorbed + i];
+            }
+            TIP5XX_COUNT(absorbed_blocks, 1);
+            Permutation::permute(state.data());
+            absorbed += to_absorb;
+        }
+    }
+
+    // Copy out the rate and permute, a block at a time
+    static void squeeze(State& state, uint8_t* output, size_t len) {
+        TIP5XX_COUNT(squeezes, 1);
+        size_t squeezed = 0;
+        while (squeezed < len) {
+            size_t to_squeeze = std::min(Rate, len - squeezed);
+            std::memcpy(output + squeezed, state.data(), to_squeeze);
+            Permutation::permute(state.data());
+            squeezed += to_squeeze;
+        }
+    }
+
+    // Absorb left, then right, into a zero state and squeeze HashSize bytes.
+    // out may alias either input.
+    static void hash_pair(const uint8_t* left, size_t left_len, const uint8_t* right, size_t right_len,
+                          Hash& out) {
+        State state{};
+        absorb(state, left, left_len);
+        absorb(state, right, right_len);
+        squeeze(state, out.data(), HashSize);
+    }
+
+    static Hash hash_pair(span<const uint8_t> left, span<const uint8_t> right) {
+        Hash out;
+        hash_pair(left.data(), left.size(), right.data(), right.size(), out);
+        return out;
+    }
+};
+
+} // namespace tip5xx
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "b_field_element.hpp"
+
+namespace tip5xx {
+
+/**
+ * The result of hashing a sequence of elements, for example using Tip5.
+ * Consists of 5 base field elements, which is compatible with
+ * `twenty_first::math::digest::Digest`.
+ */
+class Digest {
+public:
+    static constexpr size_t LEN = 5;
+    static constexpr size_t BYTES = LEN * BFieldElement::BYTES;
+
+    using Values = std::array<BFieldElement, LEN>;
+
+    // Constructors
+    Digest() : values_{} {}
+    explicit Digest(const Values& values) : values_(values) {}
+
+    // Accessors
+    const Values& values() const { return values_; }
+    Values& values() { return values_; }
+
+    const BFieldElement& operator[](size_t i) const { return values_[i]; }
+    BFieldElement& operator[](size_t i) { return values_[i]; }
+
+    // Equality
+    bool operator==(const Digest& rhs) const { return values_ == rhs.values_; }
+    bool operator!=(const Digest& rhs) const { return !(*this == rhs); }
+
+    // Convert to string representation, elements separated by commas
+    std::string to_string() const;
+
+private:
+    Values values_;
+};
+
+// Stream operator
+std::ostream& operator<<(std::ostream& os, const Digest& digest);
+
+} // namespace tip5xx
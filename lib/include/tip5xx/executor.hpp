@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace tip5xx {
+
+/**
+ * Runs batches of independent tasks on a set of threads.
+ *
+ * Every parallel algorithm in the library goes through an Executor, by
+ * default the one installed with set_default_executor(), so applications can
+ * route the work onto their own pool (TBB, a job system, ...) by implementing
+ * this interface.
+ */
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    // Threads tasks may run on, including the calling one
+    virtual size_t concurrency() const = 0;
+
+    // Run task(0), ..., task(count - 1) on up to max_threads threads including
+    // the calling one and return once all finished. Tasks do not throw;
+    // parallel_for catches and forwards exceptions itself.
+    virtual void bulk(size_t count, const std::function<void(size_t)>& task, size_t max_threads) = 0;
+};
+
+/**
+ * Fixed pool of worker threads with work stealing.
+ *
+ * A batch is split into one contiguous range of task indices per thread. Each
+ * thread runs its own range front to back and, once it is empty, steals the
+ * upper half of another thread's range, preferring threads on the same NUMA
+ * node when threads are pinned. The calling thread takes part in its batch,
+ * and a batch submitted from inside a task of the same executor runs inline,
+ * so nesting neither deadlocks nor oversubscribes.
+ */
+class WorkStealingExecutor : public Executor {
+public:
+    struct Options {
+        // Threads including the calling one; 0 uses the hardware concurrency
+        size_t num_threads = 0;
+        // Pin worker i to the i-th allowed CPU, CPUs ordered node by node (Linux only)
+        bool pin_threads = false;
+        // Group workers by NUMA node for partitioning and stealing; needs pin_threads
+        bool numa_aware = true;
+    };
+
+    explicit WorkStealingExecutor(size_t num_threads = 0);
+    explicit WorkStealingExecutor(const Options& options);
+    ~WorkStealingExecutor() override;
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    size_t concurrency() const override;
+    void bulk(size_t count, const std::function<void(size_t)>& task, size_t max_threads) override;
+
+    // NUMA nodes the workers are spread over (1 unless pinned and numa_aware)
+    size_t numa_nodes() const;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+// Executor used by parallel algorithms when none is given, created on first use
+std::shared_ptr<Executor> default_executor();
+
+// Replace the default executor; nullptr restores a WorkStealingExecutor over all
+// hardware threads. Calls already running keep the executor they started with.
+void set_default_executor(std::shared_ptr<Executor> executor);
+
+} // namespace tip5xx
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "digest.hpp"
+
+namespace tip5xx {
+
+/**
+ * Bounded, thread-safe memoization of Tip5Sponge::hash_pair.
+ *
+ * Entries are keyed by the (left, right) input digests and spread over
+ * independently locked shards. Each shard is an open-addressing table in which
+ * an entry lives within PROBE_WINDOW slots of its home slot. When that window
+ * is full, a CLOCK hand sweeps it, giving recently hit entries a second chance
+ * before one is evicted. Hashing happens outside the shard lock, so
+ * concurrent misses on the same pair may both compute it.
+ */
+class HashPairCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = size_t{1} << 16;
+    static constexpr size_t DEFAULT_SHARDS = 16;
+    static constexpr size_t PROBE_WINDOW = 8;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+
+        // Fraction of lookups served from the cache, 0 before any lookup
+        double hit_rate() const;
+    };
+
+    // Room for at least `capacity` entries over `num_shards` shards, both
+    // rounded up to powers of two. Throws std::invalid_argument if either is zero.
+    explicit HashPairCache(size_t capacity = DEFAULT_CAPACITY, size_t num_shards = DEFAULT_SHARDS);
+    ~HashPairCache();
+
+    HashPairCache(const HashPairCache&) = delete;
+    HashPairCache& operator=(const HashPairCache&) = delete;
+
+    // Same result as Tip5Sponge::hash_pair(left, right)
+    Digest hash_pair(const Digest& left, const Digest& right);
+
+    // Number of slots over all shards
+    size_t capacity() const { return num_shards_ * slots_per_shard_; }
+
+    // Statistics summed over all shards
+    Stats stats() const;
+    void reset_stats();
+
+    // Drop all entries; statistics are kept
+    void clear();
+
+private:
+    struct Shard;
+
+    size_t num_shards_;
+    size_t slots_per_shard_;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "digest.hpp"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#include <coroutine>
+#define TIP5XX_HAS_COROUTINES 1
+#else
+#define TIP5XX_HAS_COROUTINES 0
+#endif
+
+namespace tip5xx {
+
+/**
+ * Request/response front end for Tip5Sponge::hash_pair that coalesces
+ * concurrent single requests into batches for Tip5Sponge::hash_pairs.
+ *
+ * A service thread collects requests and dispatches a batch as soon as a
+ * full group of BATCH_LANES pairs is waiting, or once the oldest request has
+ * waited max_wait, taking up to max_batch pairs. Requests that arrive while a
+ * batch is being hashed are dispatched together right after it, so batches
+ * grow with load while an idle service answers within max_wait.
+ *
+ * Completions run on the service thread. The destructor finishes every
+ * request submitted before it.
+ */
+class HashService {
+public:
+    struct Options {
+        // Largest batch hashed at once
+        size_t max_batch = 256;
+        // Longest a request waits for company before it is hashed alone
+        std::chrono::microseconds max_wait{50};
+    };
+
+    struct Stats {
+        uint64_t requests = 0;
+        uint64_t batches = 0;
+
+        // Requests per batch, 0 before the first batch
+        double mean_batch_size() const;
+    };
+
+    // Completion callback of enqueue(); must not throw
+    using Completion = void (*)(void* context, const Digest& digest);
+
+    // Throws std::invalid_argument if max_batch is zero
+    HashService();
+    explicit HashService(const Options& options);
+    ~HashService();
+
+    HashService(const HashService&) = delete;
+    HashService& operator=(const HashService&) = delete;
+
+    // Future of Tip5Sponge::hash_pair(left, right)
+    std::future<Digest> hash_pair(const Digest& left, const Digest& right);
+
+#if TIP5XX_HAS_COROUTINES
+    class HashPairAwaitable;
+
+    // co_await service.async_hash_pair(left, right); resumes on the service thread
+    HashPairAwaitable async_hash_pair(const Digest& left, const Digest& right);
+#endif
+
+    // Low-level submission: complete(context, digest) is called once the pair
+    // is hashed. Throws std::logic_error once the service is shutting down.
+    void enqueue(const Digest& left, const Digest& right, Completion complete, void* context);
+
+    Stats stats() const;
+    const Options& options() const { return options_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request {
+        Digest left;
+        Digest right;
+        Completion complete;
+        void* context;
+        Clock::time_point arrival;
+    };
+
+    void run();
+
+    Options options_;
+    // Batch size dispatched without waiting, one full group of lanes
+    size_t ready_size_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Request> queue_;
+    bool stop_;
+
+    std::atomic<uint64_t> requests_;
+    std::atomic<uint64_t> batches_;
+
+    std::thread thread_;
+};
+
+#if TIP5XX_HAS_COROUTINES
+class HashService::HashPairAwaitable {
+public:
+    HashPairAwaitable(HashService& service, const Digest& left, const Digest& right)
+        : service_(service), left_(left), right_(right) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        handle_ = handle;
+        service_.enqueue(left_, right_, &HashPairAwaitable::resume, this);
+    }
+
+    Digest await_resume() const { return result_; }
+
+private:
+    static void resume(void* context, const Digest& digest) {
+        auto* self = static_cast<HashPairAwaitable*>(context);
+        self->result_ = digest;
+        self->handle_.resume();
+    }
+
+    HashService& service_;
+    Digest left_;
+    Digest right_;
+    Digest result_;
+    std::coroutine_handle<> handle_;
+};
+
+inline HashService::HashPairAwaitable HashService::async_hash_pair(const Digest& left, const Digest& right) {
+    return HashPairAwaitable(*this, left, right);
+}
+#endif
+
+} // namespace tip5xx
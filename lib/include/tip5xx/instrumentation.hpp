@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+// Optional instrumentation layer, enabled by configuring with
+// -DTIP5XX_ENABLE_INSTRUMENTATION=ON. When disabled, TIP5XX_COUNT and
+// TIP5XX_TRACE_SCOPE expand to nothing and the query functions below report
+// zeros, so instrumented call sites cost nothing.
+#if defined(TIP5XX_INSTRUMENTATION) && TIP5XX_INSTRUMENTATION
+#define TIP5XX_INSTRUMENTATION_ENABLED 1
+#else
+#define TIP5XX_INSTRUMENTATION_ENABLED 0
+#endif
+
+namespace tip5xx {
+
+constexpr bool INSTRUMENTATION_ENABLED = TIP5XX_INSTRUMENTATION_ENABLED != 0;
+
+// Work counters of a single thread
+struct InstrumentationCounters {
+    uint64_t permutations = 0;      // Tip5Sponge states permuted, one per lane in batched hashing
+    uint64_t byte_permutations = 0; // Byte-oriented Tip5 permutations
+    uint64_t absorbed_blocks = 0;   // Rate blocks absorbed by either sponge
+    uint64_t squeezes = 0;          // Squeeze calls of either sponge
+    uint64_t inversions = 0;        // Base field inversions; an XFieldElement inversion costs one
+};
+
+// Snapshot of the calling thread's counters; zeros when instrumentation is disabled
+InstrumentationCounters thread_counters();
+
+// Reset the calling thread's counters
+void reset_thread_counters();
+
+/**
+ * Tracing callbacks invoked around instrumented scopes (tree construction,
+ * batched hashing, transforms). begin receives the scope name, end the same
+ * name and the elapsed wall time in nanoseconds; either may be null.
+ * Names are string literals that outlive the program, so they can be handed
+ * straight to Perfetto or OpenTelemetry span builders. Callbacks run on the
+ * thread executing the scope and must be thread-safe.
+ *
+ * The callbacks receive user_data.get(). The hook set, and with it user_data,
+ * stays owned by every scope that began with it, so a tracer held only through
+ * user_data is destroyed after the last of those scopes has called end.
+ */
+struct TraceHooks {
+    void (*begin)(const char* name, void* user_data) = nullptr;
+    void (*end)(const char* name, uint64_t elapsed_ns, void* user_data) = nullptr;
+    std::shared_ptr<void> user_data;
+};
+
+// Install hooks process-wide; a default-constructed TraceHooks removes them.
+// Scopes already running finish with the hooks they started with, so end may
+// still be called after this returns.
+void set_trace_hooks(const TraceHooks& hooks);
+
+// RAII timer reporting one instrumented scope to the installed hooks.
+// Reads the clock only while hooks are installed.
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name);
+    ~ScopedTrace();
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* name_;
+    std::shared_ptr<const TraceHooks> hooks_;
+    uint64_t start_ns_;
+};
+
+namespace detail {
+
+#if TIP5XX_INSTRUMENTATION_ENABLED
+// Storage behind TIP5XX_COUNT; one instance per thread
+inline thread_local InstrumentationCounters instrumentation_counters;
+#endif
+
+} // namespace detail
+
+} // namespace tip5xx
+
+#define TIP5XX_INSTRUMENTATION_CONCAT_(a, b) a##b
+#define TIP5XX_INSTRUMENTATION_CONCAT(a, b) TIP5XX_INSTRUMENTATION_CONCAT_(a, b)
+
+#if TIP5XX_INSTRUMENTATION_ENABLED
+// Add n to counter `field` of InstrumentationCounters for the calling thread
+#define TIP5XX_COUNT(field, n) (::tip5xx::detail::instrumentation_counters.field += (n))
+// Report the rest of the enclosing block as scope `name` to the trace hooks
+#define TIP5XX_TRACE_SCOPE(name) \
+    ::tip5xx::ScopedTrace TIP5XX_INSTRUMENTATION_CONCAT(tip5xx_trace_scope_, __LINE__)(name)
+#else
+#define TIP5XX_COUNT(field, n) ((void)0)
+#define TIP5XX_TRACE_SCOPE(name) ((void)0)
+#endif
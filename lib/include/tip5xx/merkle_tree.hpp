@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "aligned_allocator.hpp"
+#include "digest.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Binary Merkle tree over Tip5 digests.
+ *
+ * All nodes live in one contiguous, cache-line aligned buffer with implicit
+ * heap indexing: the root is node 1, the children of node i are 2i and 2i + 1,
+ * and leaf j is node num_leafs + j. Node 0 is unused. Each layer is hashed
+ * with Tip5Sponge::hash_layer, split across threads for large layers.
+ */
+class MerkleTree {
+public:
+    static constexpr size_t ROOT_INDEX = 1;
+
+    using NodeBuffer = std::vector<Digest, AlignedAllocator<Digest, 64>>;
+
+    // Leaf index and digest pair, as used for batch verification
+    using IndexedLeaf = std::pair<size_t, Digest>;
+
+    // Build a tree; the number of leaves must be a non-zero power of two.
+    // num_threads == 0 uses default_thread_count(). Throws std::invalid_argument.
+    explicit MerkleTree(span<const Digest> leaves, size_t num_threads = 0);
+
+    Digest root() const { return nodes_[ROOT_INDEX]; }
+    size_t num_leafs() const { return num_leafs_; }
+
+    // Number of layers above the leaves, i.e. log2(num_leafs)
+    size_t height() const { return height_; }
+
+    // Node by heap index; throws std::out_of_range
+    const Digest& node(size_t index) const;
+    const Digest& leaf(size_t index) const;
+
+    // Sibling digests from the leaf up to, excluding, the root
+    std::vector<Digest> authentication_path(size_t leaf_index) const;
+
+    // Heap indices of the nodes needed to verify all given leaves at once,
+    // sorted in decreasing order; nodes computable from the leaves are omitted
+    static std::vector<size_t> authentication_structure_node_indices(size_t num_leafs,
+                                                                     span<const size_t> leaf_indices);
+
+    // Digests of the nodes returned by authentication_structure_node_indices
+    std::vector<Digest> authentication_structure(span<const size_t> leaf_indices) const;
+
+    // Verify a single leaf against a root using its authentication path
+    static bool verify(const Digest& root, size_t leaf_index, const Digest& leaf, span<const Digest> path);
+
+    // Verify several leaves with one shared authentication structure; every
+    // inner node on the way to the root is hashed once
+    static bool verify_batch(const Digest& root, size_t tree_height, span<const IndexedLeaf> leaves,
+                             span<const Digest> authentication_structure);
+
+private:
+    NodeBuffer nodes_;
+    size_t num_leafs_;
+    size_t height_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,159 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "digest.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * On-disk layout of a Merkle tree over Tip5 digests.
+ *
+ * A 4096-byte header page is followed by all nodes in the heap order of
+ * MerkleTree: node i (root 1, children of i at 2i and 2i + 1, node 0 unused)
+ * occupies DIGEST_BYTES bytes at DATA_OFFSET + i · DIGEST_BYTES, each digest
+ * stored as the canonical little-endian encoding of its five elements.
+ *
+ * Header, all integers little-endian:
+ *   0   magic "TIP5MKL1"
+ *   8   u32 format version (1)
+ *   12  u32 digest size in bytes (40)
+ *   16  u64 height
+ *   24  u64 number of leaves
+ *   32  u64 offset of node 0 (4096)
+ * The header is written last, after the body has been synced to stable storage,
+ * so an interrupted write or a crash leaves a file readers reject.
+ */
+struct MerkleTreeFileFormat {
+    static constexpr char MAGIC[8] = {'T', 'I', 'P', '5', 'M', 'K', 'L', '1'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t DIGEST_BYTES = Digest::BYTES;
+    static constexpr size_t HEADER_BYTES = 40;
+    static constexpr uint64_t DATA_OFFSET = 4096;
+};
+
+/**
+ * Builds a Merkle tree file from leaves supplied in order.
+ *
+ * Leaves are buffered in aligned chunks whose subtrees are hashed layer by
+ * layer with Tip5Sponge::hash_layer, so memory stays at one chunk plus one
+ * pending node per level above it; every layer is written sequentially.
+ * Throws std::runtime_error on I/O failure.
+ */
+class MerkleTreeFileWriter {
+public:
+    // Leaves per chunk hashed together
+    static constexpr size_t CHUNK_LEAVES = size_t{1} << 14;
+
+    // num_leafs must be a power of two between 1 and 2^56 (std::invalid_argument otherwise).
+    // num_threads == 0 uses default_thread_count().
+    MerkleTreeFileWriter(const std::string& path, uint64_t num_leafs, size_t num_threads = 0);
+    ~MerkleTreeFileWriter();
+
+    MerkleTreeFileWriter(const MerkleTreeFileWriter&) = delete;
+    MerkleTreeFileWriter& operator=(const MerkleTreeFileWriter&) = delete;
+
+    // Throws std::length_error past num_leafs
+    void append_leaf(const Digest& leaf);
+    void append_leaves(span<const Digest> leaves);
+
+    // Leaf digest Tip5Hasher::hash_bytes(data, length)
+    void append_leaf_bytes(const uint8_t* data, size_t length);
+
+    uint64_t leaves_written() const { return leaves_written_; }
+
+    // Sync the body, then write and sync the header and close the file; throws
+    // std::logic_error unless exactly num_leafs leaves were appended. Returns the root.
+    Digest finish();
+
+private:
+    void hash_chunk();
+    void push(size_t depth, const Digest& node);
+    void write_node(size_t depth, const Digest& node);
+    void write_nodes(size_t depth, span<const Digest> nodes);
+    void flush(size_t depth);
+
+    std::ofstream file_;
+    std::string path_;
+    uint64_t num_leafs_;
+    size_t height_;
+    size_t chunk_height_;
+    size_t num_threads_;
+    uint64_t leaves_written_;
+    bool finished_;
+
+    std::vector<Digest> chunk_;
+    // Last unpaired node per depth above the chunks
+    std::vector<Digest> pending_;
+    std::vector<bool> has_pending_;
+    // Encoded nodes not yet written per depth, starting at heap index buffer_start_[depth]
+    std::vector<std::vector<uint8_t>> buffers_;
+    std::vector<uint64_t> buffer_start_;
+    Digest root_;
+};
+
+/**
+ * Read-only view of a Merkle tree file.
+ *
+ * The file is memory-mapped where the platform supports it, so opening is
+ * O(1) and nodes are decoded on access; elsewhere nodes are read on demand.
+ * Throws std::runtime_error if the file is missing, truncated or not a
+ * complete tree file, and std::out_of_range for invalid indices.
+ */
+class MerkleTreeFile {
+public:
+    explicit MerkleTreeFile(const std::string& path);
+    ~MerkleTreeFile();
+
+    MerkleTreeFile(MerkleTreeFile&& other) noexcept;
+    MerkleTreeFile& operator=(MerkleTreeFile&& other) noexcept;
+    MerkleTreeFile(const MerkleTreeFile&) = delete;
+    MerkleTreeFile& operator=(const MerkleTreeFile&) = delete;
+
+    Digest root() const { return node(1); }
+    uint64_t num_leafs() const { return num_leafs_; }
+    size_t height() const { return height_; }
+
+    // Node by heap index, as MerkleTree::node
+    Digest node(uint64_t index) const;
+    Digest leaf(uint64_t index) const;
+
+    // Same as MerkleTree::authentication_path; verify with MerkleTree::verify
+    std::vector<Digest> authentication_path(uint64_t leaf_index) const;
+
+private:
+    struct Storage;
+
+    std::unique_ptr<Storage> storage_;
+    uint64_t num_leafs_;
+    size_t height_;
+};
+
+} // namespace tip5xx
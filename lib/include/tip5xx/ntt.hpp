@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "b_field_element.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Number-theoretic transform over the Goldilocks field.
+ *
+ * forward() maps the coefficients of a polynomial of degree < n to its
+ * evaluations on the subgroup generated by primitive_root_of_unity(n), in
+ * natural order; inverse() is the exact inverse, including the 1/n scaling.
+ * n must be a power of two, at most 2^32.
+ *
+ * Transforms that fit into L2 cache run an iterative radix-4 decimation in
+ * time, with a final radix-2 stage for odd log2(n). Larger ones use the
+ * four-step (Bailey) decomposition into row transforms, which are spread
+ * across threads from PARALLEL_THRESHOLD points on. Twiddle factors are
+ * computed once per domain size and cached for the lifetime of the process.
+ */
+class Ntt {
+public:
+    // Sizes from 2^FOUR_STEP_LOG2_THRESHOLD on use the four-step algorithm
+    static constexpr size_t FOUR_STEP_LOG2_THRESHOLD = 18;
+
+    // Sizes from PARALLEL_THRESHOLD on run on several threads
+    static constexpr size_t PARALLEL_THRESHOLD = size_t{1} << 20;
+
+    // In-place transforms; num_threads == 0 uses default_thread_count().
+    // Throw std::invalid_argument if the size is not a power of two or exceeds 2^32.
+    static void forward(span<BFieldElement> values, size_t num_threads = 0);
+    static void inverse(span<BFieldElement> values, size_t num_threads = 0);
+
+    // Evaluate on / interpolate from the coset offset · ⟨ω⟩
+    static void coset_forward(span<BFieldElement> values, BFieldElement offset, size_t num_threads = 0);
+    static void coset_inverse(span<BFieldElement> values, BFieldElement offset, size_t num_threads = 0);
+
+    // Low-degree extension: interpolates the evaluations on ⟨ω_n⟩ and evaluates the
+    // same polynomial on offset · ⟨ω_{n · expansion_factor}⟩. expansion_factor must
+    // be a power of two; throws std::invalid_argument.
+    static std::vector<BFieldElement> low_degree_extension(span<const BFieldElement> evaluations,
+                                                           size_t expansion_factor,
+                                                           BFieldElement offset,
+                                                           size_t num_threads = 0);
+
+    // Same, into caller storage whose size fixes the expansion factor
+    static void low_degree_extension(span<const BFieldElement> evaluations,
+                                     span<BFieldElement> out,
+                                     BFieldElement offset,
+                                     size_t num_threads = 0);
+
+    // Fill the twiddle cache for domain size n ahead of time
+    static void precompute_twiddles(size_t n);
+};
+
+} // namespace tip5xx
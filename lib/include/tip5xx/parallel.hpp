@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include "executor.hpp"
+
+namespace tip5xx {
+
+// Number of threads parallel algorithms use when none is requested,
+// the concurrency of default_executor()
+size_t default_thread_count();
+
+/**
+ * Split [0, n) into contiguous chunks of at least min_chunk items and run
+ * fn(begin, end) on each as tasks of the executor (default_executor() unless
+ * given), using up to num_threads threads including the calling one (0 or
+ * more than the executor has selects all of them). Small inputs run inline.
+ * The first exception thrown by fn is rethrown once all chunks finished.
+ */
+void parallel_for(size_t n, size_t min_chunk, const std::function<void(size_t, size_t)>& fn,
+                  size_t num_threads = 0);
+void parallel_for(Executor& executor, size_t n, size_t min_chunk,
+                  const std::function<void(size_t, size_t)>& fn, size_t num_threads = 0);
+
+} // namespace tip5xx
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "b_field_element.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Univariate polynomial over a finite field, coefficients constant term first.
+ *
+ * Coefficients are kept normalized (no trailing zeros), so the zero
+ * polynomial has no coefficients and degree -1. Multiplication picks
+ * schoolbook, Karatsuba or NTT products by size; division, multi-point
+ * evaluation and interpolation reduce to multiplication through Newton
+ * inversion and subproduct trees, giving O(n log² n) for n points.
+ *
+ * Instantiated for BFieldElement, whose NTT and lazy-reduction kernels the
+ * arithmetic is built on.
+ */
+template <typename FF>
+class Polynomial {
+public:
+    // Operands with fewer coefficients than this use schoolbook multiplication
+    static constexpr size_t KARATSUBA_THRESHOLD = 64;
+    // Products with at least this many coefficients use the NTT
+    static constexpr size_t NTT_THRESHOLD = 256;
+    // Subproduct-tree leaves cover at most this many points
+    static constexpr size_t TREE_LEAF_SIZE = 32;
+
+    Polynomial() = default;
+    explicit Polynomial(std::vector<FF> coefficients);
+
+    static Polynomial constant(const FF& value);
+    // x^n
+    static Polynomial x_to_the(size_t n);
+    // Π (x - roots[i])
+    static Polynomial zerofier(span<const FF> roots);
+
+    // Polynomial of degree < xs.size() through (xs[i], ys[i]); throws
+    // std::invalid_argument on a length mismatch or repeated x
+    static Polynomial interpolate(span<const FF> xs, span<const FF> ys);
+
+    // Value at x of the polynomial of degree < n with the given evaluations on
+    // ⟨ω_n⟩, without interpolating. n must be a power of two; throws std::invalid_argument.
+    static FF barycentric_evaluate(span<const FF> codeword, const FF& x);
+
+    const std::vector<FF>& coefficients() const { return coefficients_; }
+    int64_t degree() const { return static_cast<int64_t>(coefficients_.size()) - 1; }
+    bool is_zero() const { return coefficients_.empty(); }
+    // Zero for the zero polynomial
+    FF leading_coefficient() const;
+
+    FF evaluate(const FF& x) const;
+    std::vector<FF> batch_evaluate(span<const FF> xs) const;
+
+    Polynomial formal_derivative() const;
+    // p(factor · x)
+    Polynomial scale(const FF& factor) const;
+
+    // (quotient, remainder); throws std::invalid_argument for a zero divisor
+    std::pair<Polynomial, Polynomial> divide(const Polynomial& divisor) const;
+
+    // Products with a fixed algorithm; operator* chooses by size
+    static Polynomial naive_multiply(const Polynomial& a, const Polynomial& b);
+    static Polynomial karatsuba_multiply(const Polynomial& a, const Polynomial& b);
+    static Polynomial ntt_multiply(const Polynomial& a, const Polynomial& b);
+
+    Polynomial operator+(const Polynomial& rhs) const;
+    Polynomial operator-(const Polynomial& rhs) const;
+    Polynomial operator*(const Polynomial& rhs) const;
+    Polynomial operator*(const FF& scalar) const;
+    Polynomial operator-() const;
+    Polynomial operator/(const Polynomial& rhs) const { return divide(rhs).first; }
+    Polynomial operator%(const Polynomial& rhs) const { return divide(rhs).second; }
+
+    Polynomial& operator+=(const Polynomial& rhs) { return *this = *this + rhs; }
+    Polynomial& operator-=(const Polynomial& rhs) { return *this = *this - rhs; }
+    Polynomial& operator*=(const Polynomial& rhs) { return *this = *this * rhs; }
+
+    bool operator==(const Polynomial& rhs) const { return coefficients_ == rhs.coefficients_; }
+    bool operator!=(const Polynomial& rhs) const { return !(*this == rhs); }
+
+    // Highest degree first, e.g. "3·x^2 + 1"; "0" for the zero polynomial
+    std::string to_string() const;
+
+private:
+    class SubproductTree;
+
+    void normalize();
+
+    std::vector<FF> coefficients_;
+};
+
+template <typename FF>
+std::ostream& operator<<(std::ostream& os, const Polynomial<FF>& polynomial) {
+    return os << polynomial.to_string();
+}
+
+extern template class Polynomial<BFieldElement>;
+
+} // namespace tip5xx
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Pool of reusable, cache-line aligned scratch buffers.
+ *
+ * Buffers are handed out as RAII leases and go back to the pool when the
+ * lease is destroyed, so repeated transforms of the same size stop touching
+ * the allocator and fresh pages. Requests are rounded up to power-of-two size
+ * classes. Buffers of at least HUGE_PAGE_SIZE bytes are mapped directly and,
+ * where the platform supports it, advised to use transparent huge pages.
+ * All member functions are thread-safe.
+ */
+class ScratchArena {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t HUGE_PAGE_SIZE = size_t{2} << 20;
+    static constexpr size_t DEFAULT_MAX_CACHED_BYTES = size_t{1} << 30;
+
+    // Uninitialized storage for n elements of T, returned to the arena on destruction
+    template <typename T>
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept { swap(other); }
+        Lease& operator=(Lease&& other) noexcept {
+            Lease(std::move(other)).swap(*this);
+            return *this;
+        }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease() {
+            if (arena_ != nullptr) {
+                arena_->give_back(data_, bytes_);
+            }
+        }
+
+        T* data() const { return data_; }
+        size_t size() const { return size_; }
+        span<T> view() const { return span<T>(data_, size_); }
+        T& operator[](size_t i) const { return data_[i]; }
+
+    private:
+        friend class ScratchArena;
+        Lease(ScratchArena* arena, void* data, size_t bytes, size_t size)
+            : arena_(arena), data_(static_cast<T*>(data)), bytes_(bytes), size_(size) {}
+
+        void swap(Lease& other) noexcept {
+            std::swap(arena_, other.arena_);
+            std::swap(data_, other.data_);
+            std::swap(bytes_, other.bytes_);
+            std::swap(size_, other.size_);
+        }
+
+        ScratchArena* arena_ = nullptr;
+        T* data_ = nullptr;
+        size_t bytes_ = 0;
+        size_t size_ = 0;
+    };
+
+    // Buffers returned beyond max_cached_bytes are released immediately
+    explicit ScratchArena(size_t max_cached_bytes = DEFAULT_MAX_CACHED_BYTES);
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    // Process-wide arena used by the library's own temporaries
+    static ScratchArena& global();
+
+    // Borrow storage for n trivially copyable elements; the arena must outlive the lease
+    template <typename T>
+    Lease<T> borrow(size_t n) {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "ScratchArena only holds trivially copyable types");
+        static_assert(alignof(T) <= ALIGNMENT, "type is over-aligned for ScratchArena");
+        if (n == 0) {
+            return Lease<T>();
+        }
+        size_t bytes = size_class(n, sizeof(T));
+        return Lease<T>(this, take(bytes), bytes, n);
+    }
+
+    // Bytes held in the pool, not counting outstanding leases
+    size_t cached_bytes() const;
+
+    // Release every pooled buffer
+    void trim();
+
+private:
+    struct Block {
+        void* data;
+        size_t bytes;
+    };
+
+    // Power-of-two byte size holding n elements of elem_size; throws std::bad_array_new_length
+    static size_t size_class(size_t n, size_t elem_size);
+    static void* allocate(size_t bytes);
+    static void deallocate(void* data, size_t bytes) noexcept;
+
+    void* take(size_t bytes);
+    void give_back(void* data, size_t bytes) noexcept;
+
+    mutable std::mutex mutex_;
+    std::vector<Block> free_;
+    size_t cached_bytes_;
+    size_t max_cached_bytes_;
+};
+
+} // namespace tip5xx
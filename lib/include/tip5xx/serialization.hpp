@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "b_field_element.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+// Outcome of a bulk decode: the index of the first non-canonical element, if any
+struct DecodeStatus {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    size_t error_index = npos;
+
+    bool ok() const { return error_index == npos; }
+    explicit operator bool() const { return ok(); }
+};
+
+/**
+ * Bulk conversions between BFieldElement arrays and their canonical
+ * little-endian encodings, the same layout as raw_bytes() / raw_u16s() of
+ * consecutive elements.
+ *
+ * Values are copied as whole words and moved in and out of Montgomery form
+ * with the BFieldElementSimd kernels. Decoding checks canonicality for a block at a
+ * time and reports the first offending element instead of throwing; elements
+ * before it are decoded, later ones are unspecified. Mismatched lengths are a
+ * programming error and throw std::invalid_argument.
+ */
+
+// out.size() must be BFieldElement::BYTES * values.size()
+void encode_bytes(span<const BFieldElement> values, span<uint8_t> out);
+DecodeStatus decode_bytes(span<const uint8_t> bytes, span<BFieldElement> out);
+
+// out.size() must be 4 * values.size()
+void encode_u16s(span<const BFieldElement> values, span<uint16_t> out);
+DecodeStatus decode_u16s(span<const uint16_t> chunks, span<BFieldElement> out);
+
+} // namespace tip5xx
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace tip5xx {
+
+/**
+ * Minimal non-owning view over a contiguous sequence, modelled after
+ * C++20 std::span with a dynamic extent. The library targets C++17, so the
+ * public interfaces use this shim instead.
+ */
+template <typename T>
+class span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // Constructors
+    constexpr span() noexcept : data_(nullptr), size_(0) {}
+    constexpr span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    template <size_t N>
+    constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+    // Any contiguous container exposing data() and size(), e.g. std::vector or std::array.
+    // Temporaries are accepted only for views over const elements.
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Container>>, span> &&
+                  (std::is_lvalue_reference_v<Container> || std::is_const_v<T>) &&
+                  std::is_convertible_v<decltype(std::data(std::declval<Container&>())), T*>>>
+    constexpr span(Container&& container) noexcept
+        : data_(std::data(container)), size_(std::size(container)) {}
+
+    // Conversion from span<U>, e.g. span<T> to span<const T>
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+    constexpr span(const span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    // Accessors
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr size_t size_bytes() const noexcept { return size_ * sizeof(T); }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T& operator[](size_t i) const {
+        assert(i < size_ && "span index out of range");
+        return data_[i];
+    }
+
+    constexpr T& front() const { return (*this)[0]; }
+    constexpr T& back() const { return (*this)[size_ - 1]; }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    // Subviews
+    constexpr span first(size_t count) const {
+        assert(count <= size_ && "span::first count out of range");
+        return span(data_, count);
+    }
+
+    constexpr span last(size_t count) const {
+        assert(count <= size_ && "span::last count out of range");
+        return span(data_ + size_ - count, count);
+    }
+
+    constexpr span subspan(size_t offset, size_t count = npos) const {
+        assert(offset <= size_ && "span::subspan offset out of range");
+        return span(data_ + offset, count == npos ? size_ - offset : count);
+    }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+} // namespace tip5xx
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "digest.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+/**
+ * Persistent sparse Merkle tree over Tip5 digests with 2^height leaves.
+ *
+ * Leaves that were never written hold default_leaf, and every subtree of them
+ * hashes to a default digest precomputed once per tree, so only written paths
+ * are stored. Nodes are immutable and allocated from an arena shared by all
+ * copies of a tree: copying is O(1), and an update on one copy allocates a new
+ * path without touching the nodes other copies see. With the default leaf
+ * Digest() and a dense set of writes, the root equals that of MerkleTree over
+ * the same leaves.
+ *
+ * The arena grows in blocks that are never moved, so one copy may be updated
+ * while other copies are read; copies sharing an arena must still not be
+ * updated concurrently with each other. Nodes replaced by an update stay in
+ * the arena for the copies that reference them. Once the arena holds more
+ * than AUTO_COMPACT_MIN_NODES nodes, fewer than half of them are reachable
+ * from the updated tree and no other copy shares the arena, update() calls
+ * compact() itself. Shared arenas are left alone, since the other copies keep
+ * the old nodes alive anyway; call compact() explicitly to detach from them.
+ */
+class SparseMerkleTree {
+public:
+    static constexpr size_t MAX_HEIGHT = 64;
+    static constexpr size_t AUTO_COMPACT_MIN_NODES = size_t{1} << 12;
+
+    using Key = uint64_t;
+    using Write = std::pair<Key, Digest>;
+
+    // Tree with all leaves equal to default_leaf; throws std::invalid_argument
+    // for heights above MAX_HEIGHT
+    explicit SparseMerkleTree(size_t height = MAX_HEIGHT, const Digest& default_leaf = Digest());
+
+    Digest root() const { return digest_at(root_, height_); }
+    size_t height() const { return height_; }
+
+    // Digest of a subtree without written leaves, level 0 being a leaf
+    const Digest& default_digest(size_t level) const { return (*defaults_)[level]; }
+
+    // Leaf at key; throws std::out_of_range if key >= 2^height
+    Digest get(Key key) const;
+
+    // Write one leaf, rehashing only its path
+    void set(Key key, const Digest& leaf);
+
+    // Write several leaves; later writes to the same key win. Each node on the
+    // union of the written paths is hashed once, level by level in batches
+    // split across up to num_threads threads (0 uses default_thread_count()).
+    // Throws std::out_of_range before modifying the tree if a key is too large.
+    void update(span<const Write> writes, size_t num_threads = 0);
+
+    // Sibling digests from the leaf up to, excluding, the root
+    std::vector<Digest> authentication_path(Key key) const;
+
+    static bool verify(const Digest& root, size_t height, Key key, const Digest& leaf,
+                       span<const Digest> path);
+
+    // Nodes allocated in the arena shared with copies of this tree
+    size_t arena_size() const;
+
+    // Nodes reachable from this tree
+    size_t live_nodes() const { return live_nodes_; }
+
+    // Move the nodes reachable from this tree into a fresh arena, releasing
+    // this copy's share of the old one
+    void compact();
+
+private:
+    using NodeIndex = uint32_t;
+    static constexpr NodeIndex NIL = 0;
+
+    struct Node {
+        Digest digest;
+        NodeIndex left;
+        NodeIndex right;
+    };
+    class Arena;
+
+    const Digest& digest_at(NodeIndex index, size_t level) const;
+    NodeIndex allocate(const Digest& digest, NodeIndex left, NodeIndex right);
+    NodeIndex rebuild(NodeIndex old, size_t level, const Write* begin, const Write* end,
+                      std::vector<std::vector<NodeIndex>>& pending, size_t& replaced);
+    NodeIndex copy_into(Arena& arena, NodeIndex index) const;
+    void check_key(Key key) const;
+
+    size_t height_;
+    std::shared_ptr<const std::vector<Digest>> defaults_;
+    std::shared_ptr<Arena> arena_;
+    NodeIndex root_;
+    size_t live_nodes_;
+};
+
+} // namespace tip5xx
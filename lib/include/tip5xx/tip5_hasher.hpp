@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "b_field_element.hpp"
+#include "digest.hpp"
+#include "span.hpp"
+#include "tip5_sponge.hpp"
+
+namespace tip5xx {
+
+/**
+ * Incremental Tip5 hasher over the variable-length domain.
+ *
+ * Input can be fed in arbitrary chunks; only a partial rate block is buffered.
+ * The kind of input is fixed at construction, and the update overload for the
+ * other kind throws std::logic_error. Element hashers absorb field elements as
+ * they are, so they yield the same digest as Tip5Sponge::hash_varlen. Byte
+ * hashers pack bytes little-endian into 7-byte limbs, which are always
+ * canonical, terminate the input with a 0x01 byte and start from a sponge
+ * whose last capacity element is one, so no byte string hashes like any
+ * element sequence.
+ */
+class Tip5Hasher {
+public:
+    static constexpr size_t BYTES_PER_ELEMENT = 7;
+
+    enum class Input {
+        Elements,
+        Bytes
+    };
+
+    explicit Tip5Hasher(Input input = Input::Elements);
+
+    Input input() const { return input_; }
+
+    // Absorb bytes; throws std::logic_error unless constructed with Input::Bytes
+    void update(const uint8_t* data, size_t length);
+
+    // Absorb field elements; throws std::logic_error unless constructed with
+    // Input::Elements
+    void update(span<const BFieldElement> elements);
+
+    // Pad, squeeze the digest and reset the hasher for reuse
+    Digest finalize();
+
+    // Discard all absorbed input
+    void reset();
+
+    // Number of field elements absorbed so far, including packed bytes
+    uint64_t absorbed_elements() const { return absorbed_elements_; }
+
+    // One-shot hash of a byte buffer
+    static Digest hash_bytes(const uint8_t* data, size_t length);
+
+private:
+    Input input_;
+    Tip5Sponge sponge_;
+    Tip5Sponge::RateBlock buffer_;
+    size_t buffered_;
+
+    // Partial limb of the byte input
+    uint64_t limb_;
+    size_t limb_bytes_;
+
+    uint64_t absorbed_elements_;
+
+    void push(BFieldElement element);
+};
+
+} // namespace tip5xx
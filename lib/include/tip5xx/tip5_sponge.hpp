@@ -0,0 +1,193 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "b_field_element.hpp"
+#include "digest.hpp"
+#include "span.hpp"
+
+namespace tip5xx {
+
+namespace detail {
+
+// Canonical values of the Tip5 round constants, STATE_SIZE per round
+inline constexpr std::array<uint64_t, 80> TIP5_ROUND_CONSTANT_VALUES = {
+    13630775303355457758ULL, 16896927574093233874ULL, 10379449653650130495ULL, 1965408364413093495ULL,
+    15232538947090185111ULL, 15892634398091747074ULL, 3989134140024871768ULL, 2851411912127730865ULL,
+    8709136439293758776ULL, 3694858669662939734ULL, 12692440244315327141ULL, 10722316166358076749ULL,
+    12745429320441639448ULL, 17932424223723990421ULL, 7558102534867937463ULL, 15551047435855531404ULL,
+    17532528648579384106ULL, 5216785850422679555ULL, 15418071332095031847ULL, 11921929762955146258ULL,
+    9738718993677019874ULL, 3464580399432997147ULL, 13408434769117164050ULL, 264428218649616431ULL,
+    4436247869008081381ULL, 4063129435850804221ULL, 2865073155741120117ULL, 5749834437609765994ULL,
+    6804196764189408435ULL, 17060469201292988508ULL, 9475383556737206708ULL, 12876344085611465020ULL,
+    13835756199368269249ULL, 1648753455944344172ULL, 9836124473569258483ULL, 12867641597107932229ULL,
+    11254152636692960595ULL, 16550832737139861108ULL, 11861573970480733262ULL, 1256660473588673495ULL,
+    13879506000676455136ULL, 10564103842682358721ULL, 16142842524796397521ULL, 3287098591948630584ULL,
+    685911471061284805ULL, 5285298776918878023ULL, 18310953571768047354ULL, 3142266350630002035ULL,
+    549990724933663297ULL, 4901984846118077401ULL, 11458643033696775769ULL, 8706785264119212710ULL,
+    12521758138015724072ULL, 11877914062416978196ULL, 11333318251134523752ULL, 3933899631278608623ULL,
+    16635128972021157924ULL, 10291337173108950450ULL, 4142107155024199350ULL, 16973934533787743537ULL,
+    11068111539125175221ULL, 17546769694830203606ULL, 5315217744825068993ULL, 4609594252909613081ULL,
+    3350107164315270407ULL, 17715942834299349177ULL, 9600609149219873996ULL, 12894357635820003949ULL,
+    4597649658040514631ULL, 7735563950920491847ULL, 1663379455870887181ULL, 13889298103638829706ULL,
+    7375530351220884434ULL, 3502022433285269151ULL, 9231805330431056952ULL, 9252272755288523725ULL,
+    10014268662326746219ULL, 15565031632950843234ULL, 1209725273521819323ULL, 6024642864597845108ULL,
+};
+
+// Converts the canonical values into Montgomery form at compile time
+template <size_t N>
+constexpr std::array<BFieldElement, N> to_bfe_array(const std::array<uint64_t, N>& values) {
+    std::array<BFieldElement, N> result{};
+    for (size_t i = 0; i < N; i++) {
+        result[i] = BFieldElement::new_element(values[i]);
+    }
+    return result;
+}
+
+// x ↦ (x + 1)^3 - 1 mod 257; the result of x = 255 is 256 - 1 = 255, so every entry fits a byte
+constexpr std::array<uint8_t, 256> make_tip5_lookup_table() {
+    std::array<uint8_t, 256> table{};
+    for (uint32_t x = 0; x < 256; x++) {
+        uint32_t y = x + 1;
+        table[x] = static_cast<uint8_t>((y * y % 257 * y % 257 + 256) % 257);
+    }
+    return table;
+}
+
+} // namespace detail
+
+/**
+ * The domain separator of a sponge. Variable-length hashing starts from an
+ * all-zero state, fixed-length hashing sets every capacity element to one.
+ */
+enum class Domain {
+    VariableLength,
+    FixedLength
+};
+
+/**
+ * Tip5 over the base field ℤ_{2^64 - 2^32 + 1}.
+ *
+ * State of 16 field elements, rate 10, capacity 6 and 5 rounds. Each round
+ * applies the split-and-lookup / power-map S-box layer, the circulant MDS
+ * layer and the round constants. Outputs are compatible with
+ * `twenty_first::math::tip5::Tip5`. See https://eprint.iacr.org/2023/107
+ */
+class Tip5Sponge {
+public:
+    // Tip5 parameters
+    static constexpr size_t STATE_SIZE = 16;
+    static constexpr size_t NUM_SPLIT_AND_LOOKUP = 4;
+    static constexpr size_t LOG2_STATE_SIZE = 4;
+    static constexpr size_t CAPACITY = 6;
+    static constexpr size_t RATE = 10;
+    static constexpr size_t NUM_ROUNDS = 5;
+
+    static_assert(RATE + CAPACITY == STATE_SIZE, "Rate and capacity must fill the state");
+    static_assert(2 * Digest::LEN <= RATE, "A pair of digests must fit into the rate");
+
+    using State = std::array<BFieldElement, STATE_SIZE>;
+    using RateBlock = std::array<BFieldElement, RATE>;
+
+    // Constant tables, generated at compile time and cache-line aligned
+
+    // The lookup table with a high algebraic degree used in the S-box:
+    // x ↦ (x + 1)^3 - 1 mod 257
+    alignas(64) static constexpr std::array<uint8_t, 256> LOOKUP_TABLE = detail::make_tip5_lookup_table();
+
+    // The first column of the circulant MDS matrix
+    alignas(64) static constexpr std::array<uint64_t, STATE_SIZE> MDS_MATRIX_FIRST_COLUMN = {
+        61402, 1108, 28750, 33823, 7454, 43244, 53865, 12034,
+        56951, 27521, 41351, 40901, 12021, 59689, 26798, 17845
+    };
+
+    // STATE_SIZE Montgomery-form values per round; a round occupies exactly two cache lines
+    alignas(64) static constexpr std::array<BFieldElement, NUM_ROUNDS * STATE_SIZE> ROUND_CONSTANTS =
+        detail::to_bfe_array(detail::TIP5_ROUND_CONSTANT_VALUES);
+
+    // Constructors
+    explicit Tip5Sponge(Domain domain);
+
+    // Sponge for variable-length hashing
+    static Tip5Sponge init() {
+        return Tip5Sponge(Domain::VariableLength);
+    }
+
+    // State accessors
+    const State& state() const { return state_; }
+    State& state() { return state_; }
+
+    // Apply all rounds of the permutation to the state
+    void permutation();
+
+    // Overwrite the rate part of the state with the input and permute
+    void absorb(const RateBlock& input);
+
+    // Return the rate part of the state and permute
+    RateBlock squeeze();
+
+    // Absorb the input in rate-sized chunks, padded with [1, 0, 0, …]
+    void pad_and_absorb_all(const std::vector<BFieldElement>& input);
+
+    // Hash a pair of digests, e.g. two nodes of a Merkle tree
+    static Digest hash_pair(const Digest& left, const Digest& right);
+
+    // Hash many independent pairs, out[i] = hash_pair(lefts[i], rights[i]).
+    // Pairs are processed BATCH_LANES at a time with interleaved states so the
+    // rounds run across all lanes together. Throws std::invalid_argument if
+    // the spans differ in length.
+    static void hash_pairs(span<const Digest> lefts, span<const Digest> rights, span<Digest> out);
+
+    // Hash adjacent digests, parents[i] = hash_pair(children[2i], children[2i + 1]),
+    // i.e. one layer of a Merkle tree. Throws std::invalid_argument unless
+    // children holds exactly twice as many digests as parents.
+    static void hash_layer(span<const Digest> children, span<Digest> parents);
+
+    // Number of sponge states hash_pairs permutes together
+    static constexpr size_t BATCH_LANES = 8;
+
+    // Hash exactly RATE elements
+    static Digest hash_10(const RateBlock& input);
+
+    // Hash a variable length sequence of field elements
+    static Digest hash_varlen(const std::vector<BFieldElement>& input);
+
+    // Round building blocks
+    void round(size_t round_index);
+    void sbox_layer();
+    void mds();
+
+    // Apply the S-box to a single element by splitting it into bytes
+    static void split_and_lookup(BFieldElement& element);
+
+private:
+    State state_;
+
+    void pad_and_absorb_all(const BFieldElement* input, size_t length);
+};
+
+} // namespace tip5xx
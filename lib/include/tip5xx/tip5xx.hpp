@@ -26,24 +26,20 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <cstdint>
 #include <cassert>
 #include <cstring>
 #include <algorithm>
+#include "byte_sponge.hpp"
+#include "span.hpp"
 
 namespace tip5xx {
 
 class Tip5 {
 public:
-    // Hash a pair of byte arrays
-    static std::vector<uint8_t> hash_pair(const std::vector<uint8_t>& left, const std::vector<uint8_t>& right);
-
-    // Hash a variable length sequence of byte arrays
-    static std::vector<uint8_t> hash_varlen(const std::vector<std::vector<uint8_t>>& inputs);
-
-private:
     // TIP5 parameters
     static constexpr size_t STATE_SIZE = 63;  // Size of the sponge state in bytes
     static constexpr size_t RATE = 31;        // Rate (r) of the sponge
@@ -51,26 +47,60 @@ private:
     static constexpr size_t HASH_SIZE = 32;   // Output hash size in bytes
     static constexpr size_t ROUNDS = 80;      // Number of permutation rounds
 
-    // Round constants table
-    static constexpr uint8_t ROUND_CONSTANTS[ROUNDS] = {
-        0x01, 0x82, 0x83, 0x04, 0x85, 0x06, 0x07, 0x88,
-        0x89, 0x0A, 0x8B, 0x0C, 0x8D, 0x0E, 0x0F, 0x90,
-        0x91, 0x12, 0x93, 0x14, 0x95, 0x16, 0x17, 0x98,
-        0x99, 0x1A, 0x9B, 0x1C, 0x9D, 0x1E, 0x1F, 0xA0,
-        0xA1, 0x22, 0xA3, 0x24, 0xA5, 0x26, 0x27, 0xA8,
-        0xA9, 0x2A, 0xAB, 0x2C, 0xAD, 0x2E, 0x2F, 0xB0,
-        0xB1, 0x32, 0xB3, 0x34, 0xB5, 0x36, 0x37, 0xB8,
-        0xB9, 0x3A, 0xBB, 0x3C, 0xBD, 0x3E, 0x3F, 0xC0,
-        0xC1, 0x42, 0xC3, 0x44, 0xC5, 0x46, 0x47, 0xC8,
-        0xC9, 0x4A, 0xCB, 0x4C, 0xCD, 0x4E, 0x4F, 0xD0
-    };
+    // Fixed-size sponge state and hash output, suitable for the stack
+    using State = std::array<uint8_t, STATE_SIZE>;
+    using Hash = std::array<uint8_t, HASH_SIZE>;
+
+    // Compile-time specialized sponge and permutation for these parameters
+    using Sponge = ByteSponge<STATE_SIZE, RATE, ROUNDS, HASH_SIZE>;
+
+    // Hash a pair of byte arrays
+    static std::vector<uint8_t> hash_pair(const std::vector<uint8_t>& left, const std::vector<uint8_t>& right);
+
+    // Hash a pair of byte ranges (vectors, arrays, mapped memory) into caller-supplied
+    // storage; performs no dynamic allocations. out may alias either input.
+    static void hash_pair(span<const uint8_t> left, span<const uint8_t> right, Hash& out);
+    static void hash_pair(const uint8_t* left, size_t left_len, const uint8_t* right, size_t right_len, Hash& out);
+
+    // Hash a variable length sequence of byte arrays
+    static std::vector<uint8_t> hash_varlen(const std::vector<std::vector<uint8_t>>& inputs);
+
+    // Same chained hash over non-owning views, without dynamic allocations
+    static void hash_varlen(span<const span<const uint8_t>> inputs, Hash& out);
+
+    // Hash a variable length sequence of byte arrays with a single sponge.
+    // Each input is absorbed behind its 64-bit length, the stream is padded
+    // (pad10*1) and squeezed once; the capacity carries a varlen domain tag.
+    static Hash hash_varlen_sponge(span<const span<const uint8_t>> inputs);
+
+    // Same as above over any range whose elements convert to span<const uint8_t>
+    template <typename Iterator>
+    static Hash hash_varlen_sponge(Iterator first, Iterator last) {
+        State state;
+        size_t position = varlen_begin(state);
+        for (; first != last; ++first) {
+            span<const uint8_t> input(*first);
+            position = varlen_absorb(state, position, input.data(), input.size());
+        }
+        return varlen_finish(state, position);
+    }
+
+    // Apply the permutation to a sponge state in place
+    static void permute(State& state);
+
+private:
 
     // Helper functions
     static void xor_bytes(uint8_t* dest, const uint8_t* src, size_t len);
-    static uint8_t rotl8(uint8_t x, unsigned int n);
     static void permute(uint8_t* state);
-    static void absorb(uint8_t* state, const uint8_t* data, size_t len);
-    static void squeeze(uint8_t* state, uint8_t* output, size_t len);
+
+    // Streaming absorption for hash_varlen_sponge; position is the next rate byte
+    static size_t varlen_begin(State& state);
+    static size_t varlen_absorb(State& state, size_t position, const uint8_t* data, size_t len);
+    static size_t varlen_absorb_length(State& state, size_t position, uint64_t len);
+    // XOR bytes into the rate, permuting and counting each block it fills
+    static size_t absorb_bytes(State& state, size_t position, const uint8_t* data, size_t len);
+    static Hash varlen_finish(State& state, size_t position);
 
     // Prevent instantiation, copying and moving as all methods are static
     Tip5() = default;
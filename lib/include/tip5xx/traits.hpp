@@ -22,9 +22,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 #include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include "parallel.hpp"
+#include "scratch_arena.hpp"
+#include "span.hpp"
 
 // Base trait for types that can generate cyclic group elements
 template <typename Derived>
@@ -33,6 +39,114 @@ public:
     std::vector<Derived> cyclic_group_elements(size_t max = 0) const {
         return static_cast<const Derived*>(this)->cyclic_group_elements_impl(max);
     }
+
+    // Same as cyclic_group_elements(out.size()) written into caller storage;
+    // returns the number of elements written
+    size_t cyclic_group_elements_into(tip5xx::span<Derived> out) const {
+        const Derived& generator = *static_cast<const Derived*>(this);
+        if (out.empty()) {
+            return 0;
+        }
+        if (generator.is_zero()) {
+            out[0] = Derived::zero();
+            return 1;
+        }
+
+        size_t order = power_of_two_order();
+        if (order != 0) {
+            size_t count = std::min(order, out.size());
+            powers_into(out.first(count));
+            return count;
+        }
+
+        Derived val = generator;
+        out[0] = Derived::one();
+        size_t count = 1;
+        while (!val.is_one() && count < out.size()) {
+            out[count++] = val;
+            val *= generator;
+        }
+        return count;
+    }
+
+    // The whole subgroup of known order, or the coset offset·⟨generator⟩, with
+    // out[i] = offset·generator^i; exactly order elements are allocated up front
+    // and filled in parallel. Throws std::invalid_argument unless the generator
+    // has multiplicative order exactly order.
+    std::vector<Derived> cyclic_group_elements_of_order(size_t order, const Derived& offset = Derived::one(),
+                                                        size_t num_threads = 0) const {
+        check_order(order);
+        std::vector<Derived> result(order);
+        powers_into(result, offset, num_threads);
+        return result;
+    }
+
+    // Same into caller storage of exactly the group order, e.g. an arena lease
+    void cyclic_group_elements_of_order_into(tip5xx::span<Derived> out, const Derived& offset = Derived::one(),
+                                             size_t num_threads = 0) const {
+        check_order(out.size());
+        powers_into(out, offset, num_threads);
+    }
+
+    // out[i] = offset·generator^i for every i < out.size(), without stopping at
+    // one. Chunks run on parallel_for, each seeded with mod_pow(chunk_begin)
+    // (num_threads == 0 uses default_thread_count()).
+    void powers_into(tip5xx::span<Derived> out, const Derived& offset = Derived::one(),
+                     size_t num_threads = 0) const {
+        const Derived& generator = *static_cast<const Derived*>(this);
+        Derived* data = out.data();
+        tip5xx::parallel_for(out.size(), MIN_POWERS_CHUNK, [&](size_t begin, size_t end) {
+            Derived val = offset * generator.mod_pow_u64(begin);
+            for (size_t i = begin; i < end; i++) {
+                data[i] = val;
+                val *= generator;
+            }
+        }, num_threads);
+    }
+
+    // Multiplicative order of the generator if it is a power of two (as for
+    // every NTT domain), 0 otherwise; costs at most 64 squarings
+    size_t power_of_two_order() const {
+        Derived val = *static_cast<const Derived*>(this);
+        for (size_t log2 = 0; log2 < 8 * sizeof(size_t); log2++) {
+            if (val.is_one()) {
+                return size_t{1} << log2;
+            }
+            val *= val;
+        }
+        return 0;
+    }
+
+private:
+    // Elements per chunk below which filling powers stays on one thread; large
+    // enough that the mod_pow seeding each chunk is noise
+    static constexpr size_t MIN_POWERS_CHUNK = size_t{1} << 14;
+
+    // generator^order == 1 and generator^(order / q) != 1 for every prime q | order
+    void check_order(size_t order) const {
+        const Derived& generator = *static_cast<const Derived*>(this);
+        if (order == 0 || !generator.mod_pow_u64(order).is_one()) {
+            throw std::invalid_argument("cyclic_group_elements_of_order: generator^order is not one");
+        }
+        size_t rest = order;
+        for (size_t q = 2; q <= rest / q; q++) {
+            if (rest % q == 0) {
+                check_proper_divisor(order / q);
+                while (rest % q == 0) {
+                    rest /= q;
+                }
+            }
+        }
+        if (rest > 1) {
+            check_proper_divisor(order / rest);
+        }
+    }
+
+    void check_proper_divisor(size_t divisor) const {
+        if (static_cast<const Derived*>(this)->mod_pow_u64(divisor).is_one()) {
+            throw std::invalid_argument("cyclic_group_elements_of_order: generator has a smaller order");
+        }
+    }
 };
 
 // Base trait for types that have multiplicative inverses
@@ -57,7 +171,7 @@ public:
 template <typename Derived>
 class PrimitiveRootOfUnity {
 public:
-    static Derived primitive_root_of_unity(uint64_t n) {
+    static constexpr Derived primitive_root_of_unity(uint64_t n) {
         return Derived::primitive_root_of_unity_impl(n);
     }
 };
@@ -92,31 +206,59 @@ class FiniteField :
 public:
     // Static utility for batch inversion
     static std::vector<Derived> batch_inversion(std::vector<Derived> input) {
-        size_t input_length = input.size();
-        if (input_length == 0) {
-            return std::vector<Derived>();
-        }
-
-        Derived zero = Derived::zero();
-        Derived one = Derived::one();
-        std::vector<Derived> scratch(input_length, zero);
-        Derived acc = one;
+        batch_inversion_in_place(tip5xx::span<Derived>(input));
+        return input;
+    }
 
-        for (size_t i = 0; i < input_length; i++) {
-            assert(!input[i].is_zero() && "Cannot do batch inversion on zero");
-            scratch[i] = acc;
-            acc *= input[i];
+    // Montgomery's trick into a caller-provided output of the same size; needs no
+    // scratch memory. Large inputs are split into per-thread chunks that share a
+    // single field inversion (num_threads == 0 uses default_thread_count()).
+    // Throws the element's inverse error if any input is zero, std::invalid_argument
+    // on a size mismatch or if output partially overlaps input (output may be input).
+    static void batch_inversion(tip5xx::span<const Derived> input, tip5xx::span<Derived> output,
+                                size_t num_threads = 0) {
+        check_batch_sizes(input, output);
+        if (same_storage(input, output)) {
+            batch_inversion_in_place(output, num_threads);
+            return;
         }
+        batch_inversion_chunked(input.data(), output.data(), output.data(), input.size(), false, num_threads);
+    }
 
-        acc = acc.inverse();
+    // Same as above, inverts values in place; the buffer of prefix products is
+    // borrowed from ScratchArena::global()
+    static void batch_inversion_in_place(tip5xx::span<Derived> values, size_t num_threads = 0) {
+        auto prefix = tip5xx::ScratchArena::global().borrow<Derived>(values.size());
+        batch_inversion_chunked(values.data(), prefix.data(), values.data(), values.size(), false, num_threads);
+    }
 
-        for (int i = static_cast<int>(input_length) - 1; i >= 0; i--) {
-            Derived tmp = acc * input[i];
-            input[i] = acc * scratch[i];
-            acc = tmp;
+    // In place with caller-provided scratch of at least values.size() elements
+    static void batch_inversion_in_place(tip5xx::span<Derived> values, tip5xx::span<Derived> scratch,
+                                         size_t num_threads = 0) {
+        check_scratch_size(values, scratch);
+        batch_inversion_chunked(values.data(), scratch.data(), values.data(), values.size(), false, num_threads);
+    }
+
+    // Zero-tolerant variants: zeros map to zero, like inverse_or_zero
+    static void batch_inversion_or_zero(tip5xx::span<const Derived> input, tip5xx::span<Derived> output,
+                                        size_t num_threads = 0) {
+        check_batch_sizes(input, output);
+        if (same_storage(input, output)) {
+            batch_inversion_or_zero_in_place(output, num_threads);
+            return;
         }
+        batch_inversion_chunked(input.data(), output.data(), output.data(), input.size(), true, num_threads);
+    }
 
-        return input;
+    static void batch_inversion_or_zero_in_place(tip5xx::span<Derived> values, size_t num_threads = 0) {
+        auto prefix = tip5xx::ScratchArena::global().borrow<Derived>(values.size());
+        batch_inversion_chunked(values.data(), prefix.data(), values.data(), values.size(), true, num_threads);
+    }
+
+    static void batch_inversion_or_zero_in_place(tip5xx::span<Derived> values, tip5xx::span<Derived> scratch,
+                                                 size_t num_threads = 0) {
+        check_scratch_size(values, scratch);
+        batch_inversion_chunked(values.data(), scratch.data(), values.data(), values.size(), true, num_threads);
     }
 
     // Square helper method
@@ -124,4 +266,100 @@ public:
         const Derived* derived = static_cast<const Derived*>(this);
         return (*derived) * (*derived);
     }
+
+private:
+    // Elements per thread below which batch inversion stays on one thread
+    static constexpr size_t MIN_BATCH_INVERSION_CHUNK = size_t{1} << 14;
+
+    static void check_batch_sizes(tip5xx::span<const Derived> input, tip5xx::span<Derived> output) {
+        if (input.size() != output.size()) {
+            throw std::invalid_argument("batch_inversion: input and output sizes differ");
+        }
+    }
+
+    // The out-of-place variants use output as prefix scratch: identical storage
+    // is handled in place, any other overlap is rejected
+    static bool same_storage(tip5xx::span<const Derived> input, tip5xx::span<Derived> output) {
+        const Derived* in = input.data();
+        const Derived* out = output.data();
+        if (input.empty()) {
+            return false;
+        }
+        if (in == out) {
+            return true;
+        }
+        std::less<const Derived*> before;
+        if (before(in, out + output.size()) && before(out, in + input.size())) {
+            throw std::invalid_argument("batch_inversion: input and output partially overlap");
+        }
+        return false;
+    }
+
+    static void check_scratch_size(tip5xx::span<Derived> values, tip5xx::span<Derived> scratch) {
+        if (scratch.size() < values.size()) {
+            throw std::invalid_argument("batch_inversion: scratch is smaller than the input");
+        }
+    }
+
+    // prefix may alias output (out-of-place) and output may alias input (in place);
+    // every pass reads an index before it is written
+    static void batch_inversion_chunked(const Derived* input, Derived* prefix, Derived* output, size_t n,
+                                        bool zero_tolerant, size_t num_threads) {
+        if (n == 0) {
+            return;
+        }
+
+        size_t threads = num_threads == 0 ? tip5xx::default_thread_count() : num_threads;
+        size_t num_chunks = std::max<size_t>(1, std::min(threads, n / MIN_BATCH_INVERSION_CHUNK));
+        size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+        std::vector<Derived> chunk_products(num_chunks);
+
+        // Prefix products within each chunk
+        tip5xx::parallel_for(num_chunks, 1, [&](size_t chunk_begin, size_t chunk_end) {
+            for (size_t c = chunk_begin; c < chunk_end; c++) {
+                size_t begin = c * chunk_size;
+                size_t end = std::min(n, begin + chunk_size);
+                Derived acc = Derived::one();
+                for (size_t i = begin; i < end; i++) {
+                    prefix[i] = acc;
+                    if (!(zero_tolerant && input[i].is_zero())) {
+                        acc *= input[i];
+                    }
+                }
+                chunk_products[c] = acc;
+            }
+        }, num_chunks);
+
+        // Invert all chunk products with one field inversion
+        Derived acc = Derived::one();
+        std::vector<Derived> chunk_prefix(num_chunks);
+        for (size_t c = 0; c < num_chunks; c++) {
+            chunk_prefix[c] = acc;
+            acc *= chunk_products[c];
+        }
+        acc = acc.inverse();
+        for (size_t c = num_chunks; c-- > 0;) {
+            Derived tmp = acc * chunk_products[c];
+            chunk_products[c] = acc * chunk_prefix[c];
+            acc = tmp;
+        }
+
+        // Walk each chunk backwards from the inverse of its product
+        tip5xx::parallel_for(num_chunks, 1, [&](size_t chunk_begin, size_t chunk_end) {
+            for (size_t c = chunk_begin; c < chunk_end; c++) {
+                size_t begin = c * chunk_size;
+                size_t end = std::min(n, begin + chunk_size);
+                Derived chunk_acc = chunk_products[c];
+                for (size_t i = end; i-- > begin;) {
+                    if (zero_tolerant && input[i].is_zero()) {
+                        output[i] = Derived::zero();
+                        continue;
+                    }
+                    Derived tmp = chunk_acc * input[i];
+                    output[i] = chunk_acc * prefix[i];
+                    chunk_acc = tmp;
+                }
+            }
+        }, num_chunks);
+    }
 };
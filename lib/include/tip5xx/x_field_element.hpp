@@ -0,0 +1,163 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "b_field_element.hpp"
+#include "span.hpp"
+#include "traits.hpp"
+
+namespace tip5xx {
+
+/**
+ * Extension field element ∈ 𝔽_p[X] / (X^3 - X + 1), the cubic extension of
+ * the base field used by twenty-first. Coefficients are stored constant term
+ * first, so XFieldElement({c0, c1, c2}) is c0 + c1·X + c2·X².
+ */
+class XFieldElement : public FiniteField<XFieldElement> {
+public:
+    using FiniteField<XFieldElement>::inverse;
+    using FiniteField<XFieldElement>::inverse_or_zero;
+    using FiniteField<XFieldElement>::batch_inversion;
+    using FiniteField<XFieldElement>::batch_inversion_in_place;
+    using FiniteField<XFieldElement>::batch_inversion_or_zero;
+    using FiniteField<XFieldElement>::batch_inversion_or_zero_in_place;
+    using FiniteField<XFieldElement>::cyclic_group_elements;
+    using FiniteField<XFieldElement>::cyclic_group_elements_into;
+    using FiniteField<XFieldElement>::cyclic_group_elements_of_order;
+    using FiniteField<XFieldElement>::cyclic_group_elements_of_order_into;
+    using FiniteField<XFieldElement>::powers_into;
+    using FiniteField<XFieldElement>::power_of_two_order;
+    using FiniteField<XFieldElement>::primitive_root_of_unity;
+    using FiniteField<XFieldElement>::mod_pow_u64;
+    using FiniteField<XFieldElement>::mod_pow_u32;
+    using FiniteField<XFieldElement>::square;
+
+    static constexpr size_t EXTENSION_DEGREE = 3;
+
+    using Coefficients = std::array<BFieldElement, EXTENSION_DEGREE>;
+
+    // Constants
+    static const XFieldElement ZERO;
+    static const XFieldElement ONE;
+
+    // Constructors
+    constexpr XFieldElement() : coefficients_{} {}
+    explicit constexpr XFieldElement(const Coefficients& coefficients) : coefficients_(coefficients) {}
+
+    // Embed a base field element as the constant term
+    static constexpr XFieldElement new_const(BFieldElement element) {
+        return XFieldElement(Coefficients{element, BFieldElement(), BFieldElement()});
+    }
+
+    // Build from exactly EXTENSION_DEGREE coefficients; throws std::invalid_argument
+    static XFieldElement from_coefficients(span<const BFieldElement> coefficients);
+
+    const Coefficients& coefficients() const { return coefficients_; }
+    const BFieldElement& operator[](size_t index) const { return coefficients_[index]; }
+
+    // The base field element if this element lies in the base field
+    std::optional<BFieldElement> unlift() const;
+
+    // Static methods required by FiniteField
+    static XFieldElement zero() { return XFieldElement(); }
+    static XFieldElement one() { return new_const(BFieldElement::ONE); }
+
+    bool is_zero() const;
+    bool is_one() const;
+
+    // Implementation of Inverse trait
+    XFieldElement inverse_impl() const;
+
+    // Implementation of PrimitiveRootOfUnity trait; the roots are those of the base field
+    static XFieldElement primitive_root_of_unity_impl(uint64_t n);
+
+    // Implementation of ModPowU64 and ModPowU32 traits
+    XFieldElement mod_pow_u64_impl(uint64_t exp) const;
+    XFieldElement mod_pow_u32_impl(uint32_t exp) const;
+
+    // Implementation of CyclicGroupGenerator trait
+    std::vector<XFieldElement> cyclic_group_elements_impl(size_t max = 0) const;
+
+    XFieldElement mod_pow(uint64_t exp) const;
+
+    // Arithmetic operators; multiplication uses Karatsuba (six base multiplications)
+    XFieldElement operator+(const XFieldElement& rhs) const;
+    XFieldElement& operator+=(const XFieldElement& rhs);
+
+    XFieldElement operator-(const XFieldElement& rhs) const;
+    XFieldElement& operator-=(const XFieldElement& rhs);
+
+    XFieldElement operator*(const XFieldElement& rhs) const;
+    XFieldElement& operator*=(const XFieldElement& rhs);
+
+    XFieldElement operator/(const XFieldElement& rhs) const;
+
+    XFieldElement operator-() const;
+
+    // Mixed arithmetic with base field elements
+    XFieldElement operator+(const BFieldElement& rhs) const;
+    XFieldElement operator-(const BFieldElement& rhs) const;
+    XFieldElement operator*(const BFieldElement& rhs) const;
+    XFieldElement& operator*=(const BFieldElement& rhs);
+
+    // out[i] = scalars[i] · values[i] for whole spans through the packed
+    // BFieldElementSimd multiply; throws std::invalid_argument on a size
+    // mismatch. out may alias values.
+    static void mul_by_bfe(span<const BFieldElement> scalars, span<const XFieldElement> values,
+                           span<XFieldElement> out);
+
+    // Equality and comparison
+    bool operator==(const XFieldElement& rhs) const { return coefficients_ == rhs.coefficients_; }
+    bool operator!=(const XFieldElement& rhs) const { return !(*this == rhs); }
+
+    // Convert to string representation
+    std::string to_string() const;
+
+private:
+    Coefficients coefficients_;
+};
+
+inline constexpr XFieldElement XFieldElement::ZERO = XFieldElement();
+inline constexpr XFieldElement XFieldElement::ONE = XFieldElement::new_const(BFieldElement::ONE);
+
+inline XFieldElement operator*(const BFieldElement& lhs, const XFieldElement& rhs) {
+    return rhs * lhs;
+}
+
+inline XFieldElement operator+(const BFieldElement& lhs, const XFieldElement& rhs) {
+    return rhs + lhs;
+}
+
+// Stream operators
+std::ostream& operator<<(std::ostream& os, const XFieldElement& xfe);
+
+// Macro to simplify creation
+#define xfe(c0, c1, c2) XFieldElement(XFieldElement::Coefficients{bfe(c0), bfe(c1), bfe(c2)})
+
+} // namespace tip5xx
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/b_field_accumulator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace tip5xx {
+
+namespace {
+
+// Outputs of linear_combination accumulated together; their 24-byte
+// accumulators stay in L1 while every input vector streams past once
+constexpr size_t LINEAR_COMBINATION_BLOCK = 256;
+
+} // namespace
+
+BFieldElement dot_product(span<const BFieldElement> a, span<const BFieldElement> b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot_product: vectors must have the same length");
+    }
+
+    // Independent accumulators keep the carry chains of consecutive terms apart
+    BFieldAccumulator acc0;
+    BFieldAccumulator acc1;
+    size_t i = 0;
+    for (; i + 1 < a.size(); i += 2) {
+        acc0.mul_add(a[i], b[i]);
+        acc1.mul_add(a[i + 1], b[i + 1]);
+    }
+    if (i < a.size()) {
+        acc0.mul_add(a[i], b[i]);
+    }
+    return acc0.reduce() + acc1.reduce();
+}
+
+void axpy(BFieldElement alpha, span<const BFieldElement> x, span<BFieldElement> y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("axpy: vectors must have the same length");
+    }
+
+    // A single product per element: one reduction is already the minimum
+    for (size_t i = 0; i < x.size(); i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void linear_combination(span<const span<const BFieldElement>> vectors,
+                        span<const BFieldElement> coefficients,
+                        span<BFieldElement> out) {
+    if (vectors.size() != coefficients.size()) {
+        throw std::invalid_argument("linear_combination: need one coefficient per vector");
+    }
+    for (const span<const BFieldElement>& vector : vectors) {
+        if (vector.size() != out.size()) {
+            throw std::invalid_argument("linear_combination: vectors must match the output length");
+        }
+    }
+
+    std::array<BFieldAccumulator, LINEAR_COMBINATION_BLOCK> accumulators;
+    for (size_t begin = 0; begin < out.size(); begin += LINEAR_COMBINATION_BLOCK) {
+        size_t count = std::min(LINEAR_COMBINATION_BLOCK, out.size() - begin);
+        for (size_t i = 0; i < count; i++) {
+            accumulators[i].reset();
+        }
+        for (size_t k = 0; k < vectors.size(); k++) {
+            const BFieldElement* vector = vectors[k].data() + begin;
+            const BFieldElement& coefficient = coefficients[k];
+            for (size_t i = 0; i < count; i++) {
+                accumulators[i].mul_add(coefficient, vector[i]);
+            }
+        }
+        for (size_t i = 0; i < count; i++) {
+            out[begin + i] = accumulators[i].reduce();
+        }
+    }
+}
+
+} // namespace tip5xx
@@ -22,50 +22,12 @@
 
 #include "tip5xx/b_field_element.hpp"
 
-namespace tip5xx {
+#include <cstring>
+#include "tip5xx/instrumentation.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/x_field_element.hpp"
 
-// Initialize static constants
-const BFieldElement BFieldElement::ZERO = BFieldElement::new_element(0UL);
-const BFieldElement BFieldElement::ONE = BFieldElement::new_element(1UL);
-const BFieldElement BFieldElement::MINUS_TWO_INVERSE = BFieldElement::new_element(0x7FFFFFFF80000000);
-
-// Primitive roots lookup table
-const std::unordered_map<uint64_t, uint64_t> BFieldElement::PRIMITIVE_ROOTS = {
-    {0, 1},
-    {1, 1},
-    {2, 18446744069414584320ULL},
-    {4, 281474976710656ULL},
-    {8, 18446744069397807105ULL},
-    {16, 17293822564807737345ULL},
-    {32, 70368744161280ULL},
-    {64, 549755813888ULL},
-    {128, 17870292113338400769ULL},
-    {256, 13797081185216407910ULL},
-    {512, 1803076106186727246ULL},
-    {1024, 11353340290879379826ULL},
-    {2048, 455906449640507599ULL},
-    {4096, 17492915097719143606ULL},
-    {8192, 1532612707718625687ULL},
-    {16384, 16207902636198568418ULL},
-    {32768, 17776499369601055404ULL},
-    {65536, 6115771955107415310ULL},
-    {131072, 12380578893860276750ULL},
-    {262144, 9306717745644682924ULL},
-    {524288, 18146160046829613826ULL},
-    {1048576, 3511170319078647661ULL},
-    {2097152, 17654865857378133588ULL},
-    {4194304, 5416168637041100469ULL},
-    {8388608, 16905767614792059275ULL},
-    {16777216, 9713644485405565297ULL},
-    {33554432, 5456943929260765144ULL},
-    {67108864, 17096174751763063430ULL},
-    {134217728, 1213594585890690845ULL},
-    {268435456, 6414415596519834757ULL},
-    {536870912, 16116352524544190054ULL},
-    {1073741824, 9123114210336311365ULL},
-    {2147483648, 4614640910117430873ULL},
-    {4294967296, 1753635133440165772ULL}
-};
+namespace tip5xx {
 
 // Try to create new field element if value is canonical
 BFieldElement BFieldElement::try_new(uint64_t v) {
@@ -76,55 +38,79 @@ BFieldElement BFieldElement::try_new(uint64_t v) {
 }
 
 // Implementation of Inverse trait
+// x^(P - 2) through an addition chain; P - 2 = 0b{31 ones}0{32 ones}
 BFieldElement BFieldElement::inverse_impl() const {
     if (is_zero()) {
         throw BFieldElementInverseError();
     }
-    const BFieldElement& x = *this;
-
-    BFieldElement bin_2_ones = (*this) * (*this) * x;
-    BFieldElement bin_3_ones = (bin_2_ones * bin_2_ones) * x;
-    BFieldElement bin_6_ones = exp(bin_3_ones, 3) * bin_3_ones;
-    BFieldElement bin_12_ones = exp(bin_6_ones, 6) * bin_6_ones;
-    BFieldElement bin_24_ones = exp(bin_12_ones, 12) * bin_12_ones;
-    BFieldElement bin_30_ones = exp(bin_24_ones, 6) * bin_6_ones;
-    BFieldElement bin_31_ones = (bin_30_ones * bin_30_ones) * x;
-    BFieldElement bin_31_ones_1_zero = bin_31_ones * bin_31_ones;
-    BFieldElement bin_32_ones = (bin_31_ones * bin_31_ones) * x;
-
-    return exp(bin_31_ones_1_zero, 32) * bin_32_ones;
-}
-
-// Internal exponentiation helper
-BFieldElement BFieldElement::exp(BFieldElement base, uint64_t exponent) {
-    BFieldElement res = base;
-    for (uint64_t i = 0; i < exponent; i++) {
-        res = res * res;
-    }
-    return res;
+    TIP5XX_COUNT(inversions, 1);
+    const uint64_t x = value_;
+
+    uint64_t bin_2_ones = raw_mul(raw_mul(x, x), x);
+    uint64_t bin_3_ones = raw_mul(raw_mul(bin_2_ones, bin_2_ones), x);
+    uint64_t bin_6_ones = raw_mul(raw_square_n(bin_3_ones, 3), bin_3_ones);
+    uint64_t bin_12_ones = raw_mul(raw_square_n(bin_6_ones, 6), bin_6_ones);
+    uint64_t bin_24_ones = raw_mul(raw_square_n(bin_12_ones, 12), bin_12_ones);
+    uint64_t bin_30_ones = raw_mul(raw_square_n(bin_24_ones, 6), bin_6_ones);
+    uint64_t bin_31_ones = raw_mul(raw_mul(bin_30_ones, bin_30_ones), x);
+    uint64_t bin_31_ones_1_zero = raw_mul(bin_31_ones, bin_31_ones);
+    uint64_t bin_32_ones = raw_mul(bin_31_ones_1_zero, x);
+
+    return BFieldElement(raw_mul(raw_square_n(bin_31_ones_1_zero, 32), bin_32_ones));
 }
 
 // Montgomery exponentiation
 BFieldElement BFieldElement::mod_pow(uint64_t exp) const {
-    BFieldElement acc = ONE;
+    constexpr size_t WINDOW = 4;
+    constexpr size_t ODD_POWERS = size_t{1} << (WINDOW - 1);
 
-    // Handle countl_zero - determine bit length without using std::countl_zero
-    int bit_length = 0;
-    uint64_t temp = exp;
-    while (temp != 0) {
-        temp >>= 1;
-        bit_length++;
+    uint64_t acc = ONE.value_;
+    if (exp == 0) {
+        return ONE;
+    }
+    int bit_length = 64 - __builtin_clzll(exp);
+
+    // Short exponents do not amortize the table of odd powers
+    if (bit_length <= 2 * static_cast<int>(WINDOW)) {
+        for (int i = bit_length - 1; i >= 0; i--) {
+            acc = raw_mul(acc, acc);
+            if ((exp >> i) & 1) {
+                acc = raw_mul(acc, value_);
+            }
+        }
+        return BFieldElement(acc);
     }
 
-    for (int i = 0; i < bit_length; i++) {
-        acc = acc * acc;
+    // odd[k] = x^(2k + 1)
+    std::array<uint64_t, ODD_POWERS> odd;
+    odd[0] = value_;
+    uint64_t square = raw_mul(value_, value_);
+    for (size_t k = 1; k < ODD_POWERS; k++) {
+        odd[k] = raw_mul(odd[k - 1], square);
+    }
 
-        if (exp & (1ULL << (bit_length - 1 - i))) {
-            acc = acc * (*this);
+    int i = bit_length - 1;
+    while (i >= 0) {
+        if (((exp >> i) & 1) == 0) {
+            acc = raw_mul(acc, acc);
+            i--;
+            continue;
         }
+
+        // Longest window of at most WINDOW bits ending in a set bit
+        int low = std::max(i - static_cast<int>(WINDOW) + 1, 0);
+        while (((exp >> low) & 1) == 0) {
+            low++;
+        }
+        int width = i - low + 1;
+        uint64_t window = (exp >> low) & ((1ULL << width) - 1);
+
+        acc = raw_square_n(acc, static_cast<size_t>(width));
+        acc = raw_mul(acc, odd[window >> 1]);
+        i = low - 1;
     }
 
-    return acc;
+    return BFieldElement(acc);
 }
 
 BFieldElement BFieldElement::mod_pow_u32(uint32_t exp) const {
@@ -181,15 +167,6 @@ BFieldElement BFieldElement::from_raw_u16s(const std::array<uint16_t, 4>& chunks
     return try_new(result);
 }
 
-// Implementation of PrimitiveRootOfUnity trait
-BFieldElement BFieldElement::primitive_root_of_unity_impl(uint64_t n) {
-    auto it = PRIMITIVE_ROOTS.find(n);
-    if (it == PRIMITIVE_ROOTS.end()) {
-        throw BFieldElementPrimitiveRootError();
-    }
-    return new_element(it->second);
-}
-
 // Implementation of ModPowU64 trait
 BFieldElement BFieldElement::mod_pow_u64_impl(uint64_t exp) const {
     return mod_pow(exp);
@@ -207,6 +184,14 @@ std::vector<BFieldElement> BFieldElement::cyclic_group_elements_impl(size_t max)
         return {ZERO};
     }
 
+    // Power-of-two subgroups (every NTT domain) are preallocated and filled in parallel
+    size_t order = power_of_two_order();
+    if (order != 0) {
+        std::vector<BFieldElement> result(max == 0 ? order : std::min(order, max));
+        powers_into(result);
+        return result;
+    }
+
     BFieldElement val = *this;
     std::vector<BFieldElement> result = {ONE};
 
@@ -407,6 +392,243 @@ BFieldElement bfe_from_hex_string(const std::string& s) {
     return bfe_from(value);
 }
 
+namespace {
+
+// Texts shorter than this per thread are parsed on the calling thread
+constexpr size_t MIN_PARSE_CHUNK_BYTES = size_t{1} << 20;
+
+int hex_digit_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+bool is_list_separator(char c) {
+    return c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// SWAR helpers reading eight ASCII digits as one little-endian word
+bool is_eight_digits(const char* p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    (void)p;
+    return false;
+#else
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+#endif
+}
+
+uint64_t parse_eight_digits(const char* p) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    word = ((word & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    word = ((word & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return ((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+}
+
+// Decimal digits starting at first, as a magnitude below P
+std::from_chars_result parse_decimal_magnitude(const char* first, const char* last, uint64_t& magnitude) {
+    // 19 digits always fit in 64 bits; only longer inputs need overflow checks
+    const char* p = first;
+    const char* unchecked_end = last - first > 19 ? first + 19 : last;
+    uint64_t value = 0;
+    while (unchecked_end - p >= 8 && is_eight_digits(p)) {
+        value = value * 100000000 + parse_eight_digits(p);
+        p += 8;
+    }
+    unsigned digit;
+    for (; p != unchecked_end && (digit = static_cast<unsigned>(*p - '0')) < 10; ++p) {
+        value = value * 10 + digit;
+    }
+    bool overflow = false;
+    for (; p != last && (digit = static_cast<unsigned>(*p - '0')) < 10; ++p) {
+        overflow = overflow || __builtin_mul_overflow(value, uint64_t{10}, &value) ||
+                   __builtin_add_overflow(value, uint64_t{digit}, &value);
+    }
+    if (p == first) {
+        return {first, std::errc::invalid_argument};
+    }
+    if (overflow || value >= BFieldElement::P) {
+        return {p, std::errc::result_out_of_range};
+    }
+    magnitude = value;
+    return {p, std::errc()};
+}
+
+std::from_chars_result parse_hex(const char* first, const char* last, BFieldElement& value) {
+    const char* p = first;
+    __uint128_t parsed = 0;
+    bool overflow = false;
+    for (int digit; p != last && (digit = hex_digit_value(*p)) >= 0; ++p) {
+        parsed = (parsed << 4) | static_cast<unsigned>(digit);
+        overflow = overflow || parsed >= (static_cast<__uint128_t>(1) << 127);
+    }
+    if (p == first) {
+        return {first, std::errc::invalid_argument};
+    }
+    if (overflow) {
+        return {p, std::errc::result_out_of_range};
+    }
+    value = BFieldElement::new_element(BFieldElement::mod_reduce(parsed));
+    return {p, std::errc()};
+}
+
+// Parse the list in [begin, end), which starts at `offset` in the whole text
+BfeListParseResult parse_list_range(const char* begin, const char* end, size_t offset,
+                                    std::vector<BFieldElement>& out) {
+    BfeListParseResult result;
+    const char* p = begin;
+    while (true) {
+        while (p != end && is_list_separator(*p)) {
+            ++p;
+        }
+        if (p == end) {
+            break;
+        }
+        const char* token = p;
+
+        // Plain unsigned decimals are parsed in a single pass; anything else is
+        // delimited first and handed to bfe_parse
+        uint64_t magnitude = 0;
+        std::from_chars_result fast = parse_decimal_magnitude(token, end, magnitude);
+        if (fast.ec == std::errc() && (fast.ptr == end || is_list_separator(*fast.ptr))) {
+            out.push_back(BFieldElement::new_element(magnitude));
+            result.parsed++;
+            p = fast.ptr;
+            continue;
+        }
+        while (p != end && !is_list_separator(*p)) {
+            ++p;
+        }
+
+        BFieldElement value;
+        std::errc ec = bfe_parse(std::string_view(token, static_cast<size_t>(p - token)), value);
+        if (ec != std::errc()) {
+            result.ec = ec;
+            result.error_offset = offset + static_cast<size_t>(token - begin);
+            return result;
+        }
+        out.push_back(value);
+        result.parsed++;
+    }
+    return result;
+}
+
+} // namespace
+
+std::from_chars_result bfe_from_chars(const char* first, const char* last, BFieldElement& value, int base) {
+    if (base == 16) {
+        return parse_hex(first, last, value);
+    }
+    if (base != 10) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    bool negative = first != last && *first == '-';
+    uint64_t magnitude = 0;
+    std::from_chars_result result = parse_decimal_magnitude(first + (negative ? 1 : 0), last, magnitude);
+    if (result.ec == std::errc::invalid_argument) {
+        result.ptr = first;
+    }
+    if (result.ec == std::errc()) {
+        BFieldElement parsed = BFieldElement::new_element(magnitude);
+        value = negative ? -parsed : parsed;
+    }
+    return result;
+}
+
+std::errc bfe_parse(std::string_view text, BFieldElement& value) {
+    constexpr std::string_view WHITESPACE = " \t\n\r";
+    size_t begin = text.find_first_not_of(WHITESPACE);
+    if (begin == std::string_view::npos) {
+        return std::errc::invalid_argument;
+    }
+    text = text.substr(begin, text.find_last_not_of(WHITESPACE) + 1 - begin);
+
+    const char* first = text.data();
+    const char* last = first + text.size();
+    std::from_chars_result result;
+    if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        result = parse_hex(first + 2, last, value);
+    } else {
+        bool negative = *first == '-';
+        if (negative || *first == '+') {
+            ++first;
+        }
+        uint64_t magnitude = 0;
+        result = parse_decimal_magnitude(first, last, magnitude);
+        if (result.ec == std::errc()) {
+            BFieldElement parsed = BFieldElement::new_element(magnitude);
+            value = negative ? -parsed : parsed;
+        }
+    }
+    if (result.ec == std::errc() && result.ptr != last) {
+        return std::errc::invalid_argument;
+    }
+    return result.ec;
+}
+
+BfeListParseResult parse_bfe_list(std::string_view text, std::vector<BFieldElement>& out, size_t num_threads) {
+    size_t threads = num_threads == 0 ? default_thread_count() : num_threads;
+    size_t num_chunks = std::max<size_t>(1, std::min(threads, text.size() / MIN_PARSE_CHUNK_BYTES));
+
+    // Chunks start at line beginnings so no token is split
+    std::vector<size_t> bounds = {0};
+    for (size_t c = 1; c < num_chunks; c++) {
+        size_t nominal = std::max(bounds.back(), text.size() / num_chunks * c);
+        size_t newline = text.find('\n', nominal);
+        if (newline == std::string_view::npos) {
+            break;
+        }
+        bounds.push_back(newline + 1);
+    }
+    bounds.push_back(text.size());
+    num_chunks = bounds.size() - 1;
+
+    if (num_chunks == 1) {
+        size_t original_size = out.size();
+        BfeListParseResult result = parse_list_range(text.data(), text.data() + text.size(), 0, out);
+        if (!result.ok()) {
+            out.resize(original_size);
+            result.parsed = 0;
+        }
+        return result;
+    }
+
+    std::vector<std::vector<BFieldElement>> parts(num_chunks);
+    std::vector<BfeListParseResult> results(num_chunks);
+    parallel_for(num_chunks, 1, [&](size_t chunk_begin, size_t chunk_end) {
+        for (size_t c = chunk_begin; c < chunk_end; c++) {
+            parts[c].reserve((bounds[c + 1] - bounds[c]) / 8);
+            results[c] = parse_list_range(text.data() + bounds[c], text.data() + bounds[c + 1], bounds[c], parts[c]);
+        }
+    }, num_chunks);
+
+    BfeListParseResult total;
+    for (const BfeListParseResult& result : results) {
+        if (!result.ok()) {
+            total.ec = result.ec;
+            total.error_offset = result.error_offset;
+            return total;
+        }
+        total.parsed += result.parsed;
+    }
+    out.reserve(out.size() + total.parsed);
+    for (const std::vector<BFieldElement>& part : parts) {
+        out.insert(out.end(), part.begin(), part.end());
+    }
+    return total;
+}
+
 // Stream input operator
 std::istream& operator>>(std::istream& is, BFieldElement& bfe) {
     std::string str;
@@ -435,8 +657,8 @@ std::string BFieldElement::to_string() const {
 }
 
 // Implement XFieldElement lift
-//XFieldElement BFieldElement::lift() const {
-//    return XFieldElement::new_const(*this);
-//}
+XFieldElement BFieldElement::lift() const {
+    return XFieldElement::new_const(*this);
+}
 
 } // namespace tip5xx
@@ -0,0 +1,520 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/b_field_element_simd.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define TIP5XX_SIMD_X86 1
+#define TIP5XX_TARGET_AVX2 __attribute__((target("avx2")))
+#define TIP5XX_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define TIP5XX_SIMD_NEON 1
+#endif
+
+namespace tip5xx {
+
+namespace {
+
+static_assert(sizeof(BFieldElement) == sizeof(uint64_t), "BFieldElement must be a single machine word");
+static_assert(std::is_standard_layout_v<BFieldElement>, "BFieldElement must be standard layout");
+
+// 2^64 - P, i.e. 2^32 - 1
+constexpr uint64_t EPSILON = 0x00000000FFFFFFFFULL;
+
+using BinaryKernel = void (*)(const uint64_t*, const uint64_t*, uint64_t*, size_t);
+using ReduceKernel = void (*)(const __uint128_t*, uint64_t*, size_t);
+
+struct KernelTable {
+    BinaryKernel add;
+    BinaryKernel sub;
+    BinaryKernel mul;
+    ReduceKernel montyred;
+};
+
+// Scalar kernels, also used for the tails of the vector kernels
+void add_scalar(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (BFieldElement::from_raw_u64(a[i]) + BFieldElement::from_raw_u64(b[i])).raw_u64();
+    }
+}
+
+void sub_scalar(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (BFieldElement::from_raw_u64(a[i]) - BFieldElement::from_raw_u64(b[i])).raw_u64();
+    }
+}
+
+void mul_scalar(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = BFieldElement::montyred(static_cast<__uint128_t>(a[i]) * static_cast<__uint128_t>(b[i]));
+    }
+}
+
+void montyred_scalar(const __uint128_t* x, uint64_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = BFieldElement::montyred(x[i]);
+    }
+}
+
+constexpr KernelTable SCALAR_KERNELS = {add_scalar, sub_scalar, mul_scalar, montyred_scalar};
+
+#ifdef TIP5XX_SIMD_X86
+
+// AVX2: 4 lanes of 64 bits. There is neither an unsigned 64-bit comparison
+// nor a 64x64-bit multiplication, both are built from the available pieces.
+
+TIP5XX_TARGET_AVX2 inline __m256i avx2_ltu(__m256i a, __m256i b) {
+    const __m256i sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+}
+
+TIP5XX_TARGET_AVX2 inline __m256i avx2_add(__m256i a, __m256i b) {
+    const __m256i p = _mm256_set1_epi64x(static_cast<long long>(BFieldElement::P));
+    __m256i pb = _mm256_sub_epi64(p, b);
+    __m256i x1 = _mm256_sub_epi64(a, pb);
+    return _mm256_add_epi64(x1, _mm256_and_si256(avx2_ltu(a, pb), p));
+}
+
+TIP5XX_TARGET_AVX2 inline __m256i avx2_sub(__m256i a, __m256i b) {
+    const __m256i eps = _mm256_set1_epi64x(static_cast<long long>(EPSILON));
+    __m256i x1 = _mm256_sub_epi64(a, b);
+    return _mm256_sub_epi64(x1, _mm256_and_si256(avx2_ltu(a, b), eps));
+}
+
+TIP5XX_TARGET_AVX2 inline __m256i avx2_montyred(__m256i xl, __m256i xh) {
+    const __m256i eps = _mm256_set1_epi64x(static_cast<long long>(EPSILON));
+    __m256i a = _mm256_add_epi64(xl, _mm256_slli_epi64(xl, 32));
+    __m256i e = avx2_ltu(a, xl);  // all ones where xl + (xl << 32) overflowed
+    __m256i b = _mm256_add_epi64(_mm256_sub_epi64(a, _mm256_srli_epi64(a, 32)), e);
+    __m256i r = _mm256_sub_epi64(xh, b);
+    return _mm256_sub_epi64(r, _mm256_and_si256(avx2_ltu(xh, b), eps));
+}
+
+TIP5XX_TARGET_AVX2 inline void avx2_mul_wide(__m256i a, __m256i b, __m256i& lo, __m256i& hi) {
+    const __m256i low32 = _mm256_set1_epi64x(static_cast<long long>(EPSILON));
+    __m256i a_hi = _mm256_srli_epi64(a, 32);
+    __m256i b_hi = _mm256_srli_epi64(b, 32);
+    __m256i ll = _mm256_mul_epu32(a, b);
+    __m256i lh = _mm256_mul_epu32(a, b_hi);
+    __m256i hl = _mm256_mul_epu32(a_hi, b);
+    __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+    // Neither of the partial sums below can overflow
+    __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+    __m256i u = _mm256_add_epi64(lh, _mm256_and_si256(t, low32));
+    lo = _mm256_or_si256(_mm256_slli_epi64(u, 32), _mm256_and_si256(ll, low32));
+    hi = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(t, 32)), _mm256_srli_epi64(u, 32));
+}
+
+TIP5XX_TARGET_AVX2 void add_avx2(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_add(va, vb));
+    }
+    add_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX2 void sub_avx2(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_sub(va, vb));
+    }
+    sub_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX2 void mul_avx2(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i lo, hi;
+        avx2_mul_wide(va, vb, lo, hi);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), avx2_montyred(lo, hi));
+    }
+    mul_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX2 void montyred_avx2(const __uint128_t* x, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        // Memory holds [l0 h0 l1 h1] [l2 h2 l3 h3]; unpacking yields the
+        // lanes in the order 0, 2, 1, 3, which the final permute restores
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 2));
+        __m256i xl = _mm256_unpacklo_epi64(v0, v1);
+        __m256i xh = _mm256_unpackhi_epi64(v0, v1);
+        __m256i r = _mm256_permute4x64_epi64(avx2_montyred(xl, xh), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+    }
+    montyred_scalar(x + i, out + i, n - i);
+}
+
+constexpr KernelTable AVX2_KERNELS = {add_avx2, sub_avx2, mul_avx2, montyred_avx2};
+
+// AVX-512F: 8 lanes of 64 bits with native unsigned comparisons into masks
+
+// GCC 12's avx512fintrin.h shifts and multiplies start from an uninitialized
+// "undefined" vector, which -Wmaybe-uninitialized reports once inlined here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+TIP5XX_TARGET_AVX512 inline __m512i avx512_add(__m512i a, __m512i b) {
+    const __m512i p = _mm512_set1_epi64(static_cast<long long>(BFieldElement::P));
+    __m512i pb = _mm512_sub_epi64(p, b);
+    __m512i x1 = _mm512_sub_epi64(a, pb);
+    return _mm512_mask_add_epi64(x1, _mm512_cmplt_epu64_mask(a, pb), x1, p);
+}
+
+TIP5XX_TARGET_AVX512 inline __m512i avx512_sub(__m512i a, __m512i b) {
+    const __m512i eps = _mm512_set1_epi64(static_cast<long long>(EPSILON));
+    __m512i x1 = _mm512_sub_epi64(a, b);
+    return _mm512_mask_sub_epi64(x1, _mm512_cmplt_epu64_mask(a, b), x1, eps);
+}
+
+TIP5XX_TARGET_AVX512 inline __m512i avx512_montyred(__m512i xl, __m512i xh) {
+    const __m512i eps = _mm512_set1_epi64(static_cast<long long>(EPSILON));
+    const __m512i one = _mm512_set1_epi64(1);
+    __m512i a = _mm512_add_epi64(xl, _mm512_slli_epi64(xl, 32));
+    __mmask8 e = _mm512_cmplt_epu64_mask(a, xl);
+    __m512i b = _mm512_sub_epi64(a, _mm512_srli_epi64(a, 32));
+    b = _mm512_mask_sub_epi64(b, e, b, one);
+    __m512i r = _mm512_sub_epi64(xh, b);
+    return _mm512_mask_sub_epi64(r, _mm512_cmplt_epu64_mask(xh, b), r, eps);
+}
+
+TIP5XX_TARGET_AVX512 inline void avx512_mul_wide(__m512i a, __m512i b, __m512i& lo, __m512i& hi) {
+    const __m512i low32 = _mm512_set1_epi64(static_cast<long long>(EPSILON));
+    __m512i a_hi = _mm512_srli_epi64(a, 32);
+    __m512i b_hi = _mm512_srli_epi64(b, 32);
+    __m512i ll = _mm512_mul_epu32(a, b);
+    __m512i lh = _mm512_mul_epu32(a, b_hi);
+    __m512i hl = _mm512_mul_epu32(a_hi, b);
+    __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+    __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+    __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, low32));
+    lo = _mm512_or_si512(_mm512_slli_epi64(u, 32), _mm512_and_si512(ll, low32));
+    hi = _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(t, 32)), _mm512_srli_epi64(u, 32));
+}
+
+TIP5XX_TARGET_AVX512 void add_avx512(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(out + i, avx512_add(va, vb));
+    }
+    add_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX512 void sub_avx512(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(out + i, avx512_sub(va, vb));
+    }
+    sub_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX512 void mul_avx512(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i lo, hi;
+        avx512_mul_wide(va, vb, lo, hi);
+        _mm512_storeu_si512(out + i, avx512_montyred(lo, hi));
+    }
+    mul_scalar(a + i, b + i, out + i, n - i);
+}
+
+TIP5XX_TARGET_AVX512 void montyred_avx512(const __uint128_t* x, uint64_t* out, size_t n) {
+    const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i v0 = _mm512_loadu_si512(x + i);
+        __m512i v1 = _mm512_loadu_si512(x + i + 4);
+        __m512i xl = _mm512_permutex2var_epi64(v0, even, v1);
+        __m512i xh = _mm512_permutex2var_epi64(v0, odd, v1);
+        _mm512_storeu_si512(out + i, avx512_montyred(xl, xh));
+    }
+    montyred_scalar(x + i, out + i, n - i);
+}
+
+constexpr KernelTable AVX512_KERNELS = {add_avx512, sub_avx512, mul_avx512, montyred_avx512};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // TIP5XX_SIMD_X86
+
+#ifdef TIP5XX_SIMD_NEON
+
+// NEON: 2 lanes of 64 bits; the wide product is built from 32x32-bit vmull
+
+inline uint64x2_t neon_add(uint64x2_t a, uint64x2_t b) {
+    const uint64x2_t p = vdupq_n_u64(BFieldElement::P);
+    uint64x2_t pb = vsubq_u64(p, b);
+    uint64x2_t x1 = vsubq_u64(a, pb);
+    return vaddq_u64(x1, vandq_u64(vcltq_u64(a, pb), p));
+}
+
+inline uint64x2_t neon_sub(uint64x2_t a, uint64x2_t b) {
+    const uint64x2_t eps = vdupq_n_u64(EPSILON);
+    uint64x2_t x1 = vsubq_u64(a, b);
+    return vsubq_u64(x1, vandq_u64(vcltq_u64(a, b), eps));
+}
+
+inline uint64x2_t neon_montyred(uint64x2_t xl, uint64x2_t xh) {
+    const uint64x2_t eps = vdupq_n_u64(EPSILON);
+    uint64x2_t a = vaddq_u64(xl, vshlq_n_u64(xl, 32));
+    uint64x2_t e = vcltq_u64(a, xl);
+    uint64x2_t b = vaddq_u64(vsubq_u64(a, vshrq_n_u64(a, 32)), e);
+    uint64x2_t r = vsubq_u64(xh, b);
+    return vsubq_u64(r, vandq_u64(vcltq_u64(xh, b), eps));
+}
+
+inline void neon_mul_wide(uint64x2_t a, uint64x2_t b, uint64x2_t& lo, uint64x2_t& hi) {
+    const uint64x2_t low32 = vdupq_n_u64(EPSILON);
+    uint32x2_t a_lo = vmovn_u64(a);
+    uint32x2_t a_hi = vshrn_n_u64(a, 32);
+    uint32x2_t b_lo = vmovn_u64(b);
+    uint32x2_t b_hi = vshrn_n_u64(b, 32);
+    uint64x2_t ll = vmull_u32(a_lo, b_lo);
+    uint64x2_t lh = vmull_u32(a_lo, b_hi);
+    uint64x2_t hl = vmull_u32(a_hi, b_lo);
+    uint64x2_t hh = vmull_u32(a_hi, b_hi);
+    uint64x2_t t = vaddq_u64(hl, vshrq_n_u64(ll, 32));
+    uint64x2_t u = vaddq_u64(lh, vandq_u64(t, low32));
+    lo = vorrq_u64(vshlq_n_u64(u, 32), vandq_u64(ll, low32));
+    hi = vaddq_u64(vaddq_u64(hh, vshrq_n_u64(t, 32)), vshrq_n_u64(u, 32));
+}
+
+void add_neon(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        vst1q_u64(out + i, neon_add(vld1q_u64(a + i), vld1q_u64(b + i)));
+    }
+    add_scalar(a + i, b + i, out + i, n - i);
+}
+
+void sub_neon(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        vst1q_u64(out + i, neon_sub(vld1q_u64(a + i), vld1q_u64(b + i)));
+    }
+    sub_scalar(a + i, b + i, out + i, n - i);
+}
+
+void mul_neon(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint64x2_t lo, hi;
+        neon_mul_wide(vld1q_u64(a + i), vld1q_u64(b + i), lo, hi);
+        vst1q_u64(out + i, neon_montyred(lo, hi));
+    }
+    mul_scalar(a + i, b + i, out + i, n - i);
+}
+
+void montyred_neon(const __uint128_t* x, uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        // De-interleaving load: val[0] holds the low halves, val[1] the high halves
+        uint64x2x2_t v = vld2q_u64(reinterpret_cast<const uint64_t*>(x + i));
+        vst1q_u64(out + i, neon_montyred(v.val[0], v.val[1]));
+    }
+    montyred_scalar(x + i, out + i, n - i);
+}
+
+constexpr KernelTable NEON_KERNELS = {add_neon, sub_neon, mul_neon, montyred_neon};
+
+#endif // TIP5XX_SIMD_NEON
+
+const KernelTable& kernel_table(SimdKernel kernel) {
+    switch (kernel) {
+#ifdef TIP5XX_SIMD_X86
+        case SimdKernel::AVX2:
+            return AVX2_KERNELS;
+        case SimdKernel::AVX512:
+            return AVX512_KERNELS;
+#endif
+#ifdef TIP5XX_SIMD_NEON
+        case SimdKernel::NEON:
+            return NEON_KERNELS;
+#endif
+        default:
+            return SCALAR_KERNELS;
+    }
+}
+
+SimdKernel detect_kernel() {
+#ifdef TIP5XX_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdKernel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdKernel::AVX2;
+    }
+#endif
+#ifdef TIP5XX_SIMD_NEON
+    return SimdKernel::NEON;
+#endif
+    return SimdKernel::Scalar;
+}
+
+const KernelTable& active_table() {
+    static const KernelTable& table = kernel_table(BFieldElementSimd::active_kernel());
+    return table;
+}
+
+const KernelTable& checked_table(SimdKernel kernel) {
+    if (!BFieldElementSimd::is_supported(kernel)) {
+        throw std::invalid_argument(std::string("SIMD kernel not supported: ") + BFieldElementSimd::kernel_name(kernel));
+    }
+    return kernel_table(kernel);
+}
+
+void check_lengths(size_t a, size_t b, size_t out) {
+    if (a != b || a != out) {
+        throw std::invalid_argument("BFieldElementSimd: input and output lengths must match");
+    }
+}
+
+const uint64_t* raw(span<const BFieldElement> s) {
+    return reinterpret_cast<const uint64_t*>(s.data());
+}
+
+uint64_t* raw(span<BFieldElement> s) {
+    return reinterpret_cast<uint64_t*>(s.data());
+}
+
+} // namespace
+
+SimdKernel BFieldElementSimd::active_kernel() {
+    static const SimdKernel kernel = detect_kernel();
+    return kernel;
+}
+
+bool BFieldElementSimd::is_supported(SimdKernel kernel) {
+    switch (kernel) {
+        case SimdKernel::Scalar:
+            return true;
+#ifdef TIP5XX_SIMD_X86
+        case SimdKernel::AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+        case SimdKernel::AVX512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f");
+#endif
+#ifdef TIP5XX_SIMD_NEON
+        case SimdKernel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* BFieldElementSimd::kernel_name(SimdKernel kernel) {
+    switch (kernel) {
+        case SimdKernel::Scalar:
+            return "scalar";
+        case SimdKernel::AVX2:
+            return "avx2";
+        case SimdKernel::AVX512:
+            return "avx512";
+        case SimdKernel::NEON:
+            return "neon";
+    }
+    return "unknown";
+}
+
+void BFieldElementSimd::add(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    active_table().add(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::sub(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    active_table().sub(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::mul(span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    active_table().mul(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::montyred(span<const __uint128_t> x, span<uint64_t> out) {
+    check_lengths(x.size(), out.size(), out.size());
+    active_table().montyred(x.data(), out.data(), out.size());
+}
+
+void BFieldElementSimd::add(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    checked_table(kernel).add(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::sub(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    checked_table(kernel).sub(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::mul(SimdKernel kernel, span<const BFieldElement> a, span<const BFieldElement> b, span<BFieldElement> out) {
+    check_lengths(a.size(), b.size(), out.size());
+    checked_table(kernel).mul(raw(a), raw(b), raw(out), out.size());
+}
+
+void BFieldElementSimd::montyred(SimdKernel kernel, span<const __uint128_t> x, span<uint64_t> out) {
+    check_lengths(x.size(), out.size(), out.size());
+    checked_table(kernel).montyred(x.data(), out.data(), out.size());
+}
+
+void BFieldElementSimd::add_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    active_table().add(a, b, out, n);
+}
+
+void BFieldElementSimd::sub_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    active_table().sub(a, b, out, n);
+}
+
+void BFieldElementSimd::mul_raw(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) {
+    active_table().mul(a, b, out, n);
+}
+
+} // namespace tip5xx
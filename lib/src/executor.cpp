@@ -0,0 +1,349 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tip5xx {
+
+namespace {
+
+// CPUs per NUMA node, from sysfs; a single node with no CPUs listed when unknown
+std::vector<std::vector<int>> numa_topology() {
+    std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    for (int node = 0; node < 1024; node++) {
+        std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!in) {
+            continue;
+        }
+        // Ranges such as "0-3,8-11"
+        std::vector<int> cpus;
+        std::string range;
+        while (std::getline(in, range, ',')) {
+            int first = 0;
+            int last = 0;
+            int fields = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+            if (fields < 1) {
+                continue;
+            }
+            if (fields == 1) {
+                last = first;
+            }
+            for (int cpu = first; cpu <= last; cpu++) {
+                if (!have_mask || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        if (!cpus.empty()) {
+            nodes.push_back(std::move(cpus));
+        }
+    }
+    if (nodes.empty() && have_mask) {
+        std::vector<int> cpus;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed)) {
+                cpus.push_back(cpu);
+            }
+        }
+        nodes.push_back(std::move(cpus));
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.emplace_back();
+    }
+    return nodes;
+}
+
+bool pin_to_cpu(std::thread& thread, int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace
+
+struct WorkStealingExecutor::Impl {
+    struct Job {
+        const std::function<void(size_t)>* task;
+        size_t participants;
+        std::atomic<size_t> remaining;
+    };
+
+    // Task indices [begin, end) of job still to run by one thread
+    struct alignas(64) Slot {
+        std::mutex mutex;
+        Job* job = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    // Executor whose batch the current thread is running, to detect nesting
+    static thread_local const Impl* current;
+
+    size_t threads;
+    size_t nodes;
+    std::unique_ptr<Slot[]> slots;
+    // Threads to steal from, nearest first
+    std::vector<std::vector<size_t>> victims;
+    std::vector<std::thread> workers;
+
+    std::mutex submit_mutex;
+
+    std::mutex wake_mutex;
+    std::condition_variable wake_cv;
+    uint64_t epoch = 0;
+    size_t participants = 0;
+    bool stop = false;
+
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+
+    explicit Impl(const Options& options) {
+        size_t hardware = std::thread::hardware_concurrency();
+        threads = options.num_threads != 0 ? options.num_threads : std::max<size_t>(1, hardware);
+        slots.reset(new Slot[threads]);
+
+        // Thread i (0 is the caller) is assigned CPU order[i] on node node_of[i]
+        std::vector<std::vector<int>> topology = options.pin_threads ? numa_topology()
+                                                                     : std::vector<std::vector<int>>(1);
+        std::vector<int> order;
+        std::vector<size_t> cpu_node;
+        for (size_t node = 0; node < topology.size(); node++) {
+            for (int cpu : topology[node]) {
+                order.push_back(cpu);
+                cpu_node.push_back(node);
+            }
+        }
+        std::vector<size_t> node_of(threads, 0);
+        if (options.numa_aware && !order.empty()) {
+            for (size_t i = 0; i < threads; i++) {
+                node_of[i] = cpu_node[i % order.size()];
+            }
+        }
+        nodes = *std::max_element(node_of.begin(), node_of.end()) + 1;
+
+        victims.resize(threads);
+        for (size_t i = 0; i < threads; i++) {
+            for (size_t pass = 0; pass < 2; pass++) {
+                for (size_t d = 1; d < threads; d++) {
+                    size_t v = (i + d) % threads;
+                    if ((node_of[v] == node_of[i]) == (pass == 0)) {
+                        victims[i].push_back(v);
+                    }
+                }
+            }
+        }
+
+        workers.reserve(threads - 1);
+        for (size_t i = 1; i < threads; i++) {
+            workers.emplace_back([this, i] { worker_loop(i); });
+            if (options.pin_threads && !order.empty()) {
+                pin_to_cpu(workers.back(), order[i % order.size()]);
+            }
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            stop = true;
+        }
+        wake_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    bool take(size_t self, Job*& job, size_t& index) {
+        {
+            Slot& own = slots[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.begin < own.end) {
+                job = own.job;
+                index = own.begin++;
+                return true;
+            }
+        }
+        for (size_t v : victims[self]) {
+            size_t begin = 0;
+            size_t end = 0;
+            {
+                Slot& victim = slots[v];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                // Threads beyond the batch's limit that are still looking for work stay out
+                if (victim.begin == victim.end || self >= victim.job->participants) {
+                    continue;
+                }
+                // Upper half, so the victim keeps walking its range in order
+                size_t half = (victim.end - victim.begin + 1) / 2;
+                job = victim.job;
+                begin = victim.end - half;
+                end = victim.end;
+                victim.end = begin;
+            }
+            index = begin;
+            if (begin + 1 < end) {
+                Slot& own = slots[self];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                own.job = job;
+                own.begin = begin + 1;
+                own.end = end;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void run_tasks(size_t self) {
+        const Impl* outer = current;
+        current = this;
+        Job* job = nullptr;
+        size_t index = 0;
+        while (take(self, job, index)) {
+            (*job->task)(index);
+            if (job->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(done_mutex);
+                done_cv.notify_all();
+            }
+        }
+        current = outer;
+    }
+
+    void worker_loop(size_t self) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex);
+                wake_cv.wait(lock, [&] { return stop || epoch != seen; });
+                if (stop) {
+                    return;
+                }
+                seen = epoch;
+                if (self >= participants) {
+                    continue;
+                }
+            }
+            run_tasks(self);
+        }
+    }
+
+    void bulk(size_t count, const std::function<void(size_t)>& task, size_t max_threads) {
+        size_t used = std::min({threads, max_threads == 0 ? threads : max_threads, count});
+        if (used <= 1 || current == this) {
+            for (size_t i = 0; i < count; i++) {
+                task(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(submit_mutex);
+        Job job{&task, used, {count}};
+        for (size_t i = 0; i < used; i++) {
+            Slot& slot = slots[i];
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            slot.job = &job;
+            slot.begin = i * count / used;
+            slot.end = (i + 1) * count / used;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            epoch++;
+            participants = used;
+        }
+        wake_cv.notify_all();
+
+        run_tasks(0);
+
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&] { return job.remaining.load(std::memory_order_acquire) == 0; });
+    }
+};
+
+thread_local const WorkStealingExecutor::Impl* WorkStealingExecutor::Impl::current = nullptr;
+
+WorkStealingExecutor::WorkStealingExecutor(size_t num_threads)
+    : WorkStealingExecutor(Options{num_threads, false, true}) {}
+
+WorkStealingExecutor::WorkStealingExecutor(const Options& options) : impl_(new Impl(options)) {}
+
+WorkStealingExecutor::~WorkStealingExecutor() = default;
+
+size_t WorkStealingExecutor::concurrency() const {
+    return impl_->threads;
+}
+
+void WorkStealingExecutor::bulk(size_t count, const std::function<void(size_t)>& task, size_t max_threads) {
+    impl_->bulk(count, task, max_threads);
+}
+
+size_t WorkStealingExecutor::numa_nodes() const {
+    return impl_->nodes;
+}
+
+namespace {
+
+std::mutex default_executor_mutex;
+std::shared_ptr<Executor> default_executor_instance;
+
+} // namespace
+
+std::shared_ptr<Executor> default_executor() {
+    std::lock_guard<std::mutex> lock(default_executor_mutex);
+    if (!default_executor_instance) {
+        default_executor_instance = std::make_shared<WorkStealingExecutor>();
+    }
+    return default_executor_instance;
+}
+
+void set_default_executor(std::shared_ptr<Executor> executor) {
+    std::lock_guard<std::mutex> lock(default_executor_mutex);
+    default_executor_instance = std::move(executor);
+}
+
+} // namespace tip5xx
@@ -0,0 +1,191 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/hash_pair_cache.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/tip5_sponge.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+struct Slot {
+    Digest left;
+    Digest right;
+    Digest value;
+    bool occupied = false;
+    bool referenced = false;
+};
+
+size_t round_up_to_power_of_two(size_t n) {
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Digests are already uniformly distributed, but equal-prefix inputs such as
+// default leaves are common, so all ten elements are mixed in
+uint64_t key_hash(const Digest& left, const Digest& right) {
+    uint64_t h = 0x9e3779b97f4a7c15ULL;
+    auto mix = [&h](const Digest& digest) {
+        for (size_t i = 0; i < Digest::LEN; i++) {
+            h = (h ^ digest[i].raw_u64()) * 0xff51afd7ed558ccdULL;
+            h ^= h >> 32;
+        }
+    };
+    mix(left);
+    mix(right);
+    return h;
+}
+
+// Bits of the key hash selecting the shard; the low bits select the slot
+constexpr unsigned SHARD_SHIFT = 40;
+
+} // namespace
+
+struct alignas(64) HashPairCache::Shard {
+    std::mutex mutex;
+    std::vector<Slot> slots;
+    size_t hand = 0;
+    Stats stats;
+
+    // Slot holding (left, right) within the probe window of home, or nullptr
+    Slot* find(size_t home, const Digest& left, const Digest& right) {
+        size_t mask = slots.size() - 1;
+        for (size_t k = 0; k < PROBE_WINDOW; k++) {
+            Slot& slot = slots[(home + k) & mask];
+            if (slot.occupied && slot.left == left && slot.right == right) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    // Free slot in the probe window of home, evicting with CLOCK if none is empty
+    Slot& claim(size_t home) {
+        size_t mask = slots.size() - 1;
+        for (size_t k = 0; k < PROBE_WINDOW; k++) {
+            Slot& slot = slots[(home + k) & mask];
+            if (!slot.occupied) {
+                return slot;
+            }
+        }
+        // Every referenced slot is cleared on the first lap, so this ends within two
+        for (;;) {
+            Slot& slot = slots[(home + hand++ % PROBE_WINDOW) & mask];
+            if (!slot.referenced) {
+                stats.evictions++;
+                return slot;
+            }
+            slot.referenced = false;
+        }
+    }
+};
+
+double HashPairCache::Stats::hit_rate() const {
+    uint64_t lookups = hits + misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+HashPairCache::HashPairCache(size_t capacity, size_t num_shards) {
+    if (capacity == 0 || num_shards == 0) {
+        throw std::invalid_argument("HashPairCache: capacity and number of shards must be positive");
+    }
+    num_shards_ = round_up_to_power_of_two(num_shards);
+    if (num_shards_ > (size_t{1} << (64 - SHARD_SHIFT))) {
+        throw std::invalid_argument("HashPairCache: too many shards");
+    }
+    size_t per_shard = (capacity + num_shards_ - 1) / num_shards_;
+    slots_per_shard_ = round_up_to_power_of_two(per_shard < PROBE_WINDOW ? PROBE_WINDOW : per_shard);
+
+    shards_.reset(new Shard[num_shards_]);
+    for (size_t i = 0; i < num_shards_; i++) {
+        shards_[i].slots.resize(slots_per_shard_);
+    }
+}
+
+HashPairCache::~HashPairCache() = default;
+
+Digest HashPairCache::hash_pair(const Digest& left, const Digest& right) {
+    uint64_t h = key_hash(left, right);
+    Shard& shard = shards_[(h >> SHARD_SHIFT) & (num_shards_ - 1)];
+    size_t home = static_cast<size_t>(h) & (slots_per_shard_ - 1);
+
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (Slot* slot = shard.find(home, left, right)) {
+            slot->referenced = true;
+            shard.stats.hits++;
+            return slot->value;
+        }
+        shard.stats.misses++;
+    }
+
+    Digest value = Tip5Sponge::hash_pair(left, right);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.find(home, left, right) == nullptr) {
+        Slot& slot = shard.claim(home);
+        slot.left = left;
+        slot.right = right;
+        slot.value = value;
+        slot.occupied = true;
+        slot.referenced = false;
+    }
+    return value;
+}
+
+HashPairCache::Stats HashPairCache::stats() const {
+    Stats total;
+    for (size_t i = 0; i < num_shards_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total.hits += shards_[i].stats.hits;
+        total.misses += shards_[i].stats.misses;
+        total.evictions += shards_[i].stats.evictions;
+    }
+    return total;
+}
+
+void HashPairCache::reset_stats() {
+    for (size_t i = 0; i < num_shards_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        shards_[i].stats = Stats{};
+    }
+}
+
+void HashPairCache::clear() {
+    for (size_t i = 0; i < num_shards_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        for (Slot& slot : shards_[i].slots) {
+            slot.occupied = false;
+            slot.referenced = false;
+        }
+        shards_[i].hand = 0;
+    }
+}
+
+} // namespace tip5xx
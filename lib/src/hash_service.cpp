@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/hash_service.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Batches with fewer pairs are hashed on the service thread
+constexpr size_t MIN_PAIRS_PER_THREAD = 1024;
+
+void fulfil_promise(void* context, const Digest& digest) {
+    auto* promise = static_cast<std::promise<Digest>*>(context);
+    promise->set_value(digest);
+    delete promise;
+}
+
+} // namespace
+
+double HashService::Stats::mean_batch_size() const {
+    return batches == 0 ? 0.0 : static_cast<double>(requests) / static_cast<double>(batches);
+}
+
+HashService::HashService() : HashService(Options()) {}
+
+HashService::HashService(const Options& options)
+    : options_(options), ready_size_(0), stop_(false), requests_(0), batches_(0) {
+    if (options_.max_batch == 0) {
+        throw std::invalid_argument("HashService: max_batch must be positive");
+    }
+    ready_size_ = std::min(options_.max_batch, Tip5Sponge::BATCH_LANES);
+    // A dedicated thread rather than an executor task: it mostly sleeps on the queue
+    thread_ = std::thread([this] { run(); });
+}
+
+HashService::~HashService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+std::future<Digest> HashService::hash_pair(const Digest& left, const Digest& right) {
+    auto* promise = new std::promise<Digest>();
+    std::future<Digest> future = promise->get_future();
+    try {
+        enqueue(left, right, &fulfil_promise, promise);
+    } catch (...) {
+        delete promise;
+        throw;
+    }
+    return future;
+}
+
+void HashService::enqueue(const Digest& left, const Digest& right, Completion complete, void* context) {
+    Clock::time_point now = Clock::now();
+    size_t pending = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) {
+            throw std::logic_error("HashService: service is shutting down");
+        }
+        queue_.push_back(Request{left, right, complete, context, now});
+        pending = queue_.size();
+    }
+    // Wake the service when it has to start timing a request or may dispatch
+    if (pending == 1 || pending == ready_size_) {
+        cv_.notify_one();
+    }
+}
+
+HashService::Stats HashService::stats() const {
+    Stats stats;
+    stats.requests = requests_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void HashService::run() {
+    std::vector<Request> batch;
+    std::vector<Digest> lefts;
+    std::vector<Digest> rights;
+    std::vector<Digest> digests;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        cv_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+        Clock::time_point deadline = queue_.front().arrival + options_.max_wait;
+        cv_.wait_until(lock, deadline, [&] { return stop_ || queue_.size() >= ready_size_; });
+
+        size_t take = std::min(queue_.size(), options_.max_batch);
+        if (take == queue_.size()) {
+            batch.swap(queue_);
+        } else {
+            batch.assign(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(take));
+            queue_.erase(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(take));
+        }
+        lock.unlock();
+
+        lefts.resize(take);
+        rights.resize(take);
+        digests.resize(take);
+        for (size_t i = 0; i < take; i++) {
+            lefts[i] = batch[i].left;
+            rights[i] = batch[i].right;
+        }
+        parallel_for(take, MIN_PAIRS_PER_THREAD, [&](size_t begin, size_t end) {
+            Tip5Sponge::hash_pairs(span<const Digest>(lefts.data() + begin, end - begin),
+                                   span<const Digest>(rights.data() + begin, end - begin),
+                                   span<Digest>(digests.data() + begin, end - begin));
+        });
+        requests_.fetch_add(take, std::memory_order_relaxed);
+        batches_.fetch_add(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < take; i++) {
+            batch[i].complete(batch[i].context, digests[i]);
+        }
+        batch.clear();
+
+        lock.lock();
+    }
+}
+
+} // namespace tip5xx
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/instrumentation.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace tip5xx {
+
+namespace {
+
+// The current hook set. Each ScopedTrace that sees it keeps a reference until
+// it has called end, so a replaced set and its user_data outlive running scopes
+std::shared_ptr<const TraceHooks> installed_hooks;
+
+// Whether a set is installed, checked first so scopes skip the shared_ptr
+// load while tracing is off
+std::atomic<bool> hooks_installed{false};
+
+// Serializes installs so the flag and the set agree
+std::mutex& hooks_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+InstrumentationCounters thread_counters() {
+#if TIP5XX_INSTRUMENTATION_ENABLED
+    return detail::instrumentation_counters;
+#else
+    return InstrumentationCounters{};
+#endif
+}
+
+void reset_thread_counters() {
+#if TIP5XX_INSTRUMENTATION_ENABLED
+    detail::instrumentation_counters = InstrumentationCounters{};
+#endif
+}
+
+void set_trace_hooks(const TraceHooks& hooks) {
+    std::shared_ptr<const TraceHooks> installed;
+    if (hooks.begin != nullptr || hooks.end != nullptr) {
+        installed = std::make_shared<const TraceHooks>(hooks);
+    }
+    std::lock_guard<std::mutex> lock(hooks_mutex());
+    hooks_installed.store(installed != nullptr, std::memory_order_relaxed);
+    std::atomic_store_explicit(&installed_hooks, std::move(installed), std::memory_order_release);
+}
+
+ScopedTrace::ScopedTrace(const char* name) : name_(name), start_ns_(0) {
+    if (!hooks_installed.load(std::memory_order_relaxed)) {
+        return;
+    }
+    hooks_ = std::atomic_load_explicit(&installed_hooks, std::memory_order_acquire);
+    if (hooks_ == nullptr) {
+        return;
+    }
+    if (hooks_->begin != nullptr) {
+        hooks_->begin(name_, hooks_->user_data.get());
+    }
+    start_ns_ = now_ns();
+}
+
+ScopedTrace::~ScopedTrace() {
+    if (hooks_ != nullptr && hooks_->end != nullptr) {
+        hooks_->end(name_, now_ns() - start_ns_, hooks_->user_data.get());
+    }
+}
+
+} // namespace tip5xx
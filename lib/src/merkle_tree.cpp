@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/merkle_tree.hpp"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include "tip5xx/instrumentation.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Layers with fewer parents are hashed on the calling thread
+constexpr size_t MIN_PARENTS_PER_THREAD = 1024;
+
+bool is_power_of_two(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+size_t log2_exact(size_t n) {
+    size_t log = 0;
+    while ((static_cast<size_t>(1) << log) < n) {
+        log++;
+    }
+    return log;
+}
+
+} // namespace
+
+MerkleTree::MerkleTree(span<const Digest> leaves, size_t num_threads)
+    : num_leafs_(leaves.size()), height_(0) {
+    if (!is_power_of_two(num_leafs_)) {
+        throw std::invalid_argument("MerkleTree: number of leaves must be a non-zero power of two, got " +
+                                    std::to_string(num_leafs_));
+    }
+    height_ = log2_exact(num_leafs_);
+    TIP5XX_TRACE_SCOPE("tip5xx::MerkleTree::build");
+
+    nodes_.resize(2 * num_leafs_);
+    std::copy(leaves.begin(), leaves.end(), nodes_.begin() + num_leafs_);
+
+    // Layer with parents [first, 2 * first) is built from children [2 * first, 4 * first)
+    for (size_t first = num_leafs_ / 2; first >= ROOT_INDEX; first /= 2) {
+        Digest* parents = nodes_.data() + first;
+        const Digest* children = nodes_.data() + 2 * first;
+        parallel_for(first, MIN_PARENTS_PER_THREAD, [&](size_t begin, size_t end) {
+            Tip5Sponge::hash_layer(span<const Digest>(children + 2 * begin, 2 * (end - begin)),
+                                   span<Digest>(parents + begin, end - begin));
+        }, num_threads);
+    }
+}
+
+const Digest& MerkleTree::node(size_t index) const {
+    if (index == 0 || index >= nodes_.size()) {
+        throw std::out_of_range("MerkleTree: node index " + std::to_string(index) + " out of range");
+    }
+    return nodes_[index];
+}
+
+const Digest& MerkleTree::leaf(size_t index) const {
+    if (index >= num_leafs_) {
+        throw std::out_of_range("MerkleTree: leaf index " + std::to_string(index) + " out of range");
+    }
+    return nodes_[num_leafs_ + index];
+}
+
+std::vector<Digest> MerkleTree::authentication_path(size_t leaf_index) const {
+    if (leaf_index >= num_leafs_) {
+        throw std::out_of_range("MerkleTree: leaf index " + std::to_string(leaf_index) + " out of range");
+    }
+
+    std::vector<Digest> path;
+    path.reserve(height_);
+    for (size_t index = num_leafs_ + leaf_index; index > ROOT_INDEX; index /= 2) {
+        path.push_back(nodes_[index ^ 1]);
+    }
+    return path;
+}
+
+std::vector<size_t> MerkleTree::authentication_structure_node_indices(size_t num_leafs,
+                                                                      span<const size_t> leaf_indices) {
+    if (!is_power_of_two(num_leafs)) {
+        throw std::invalid_argument("MerkleTree: number of leaves must be a non-zero power of two");
+    }
+
+    // Nodes on some path to the root can be computed, their siblings are needed
+    std::set<size_t> computable;
+    std::set<size_t> siblings;
+    for (size_t leaf_index : leaf_indices) {
+        if (leaf_index >= num_leafs) {
+            throw std::out_of_range("MerkleTree: leaf index " + std::to_string(leaf_index) + " out of range");
+        }
+        for (size_t index = num_leafs + leaf_index; index > ROOT_INDEX; index /= 2) {
+            computable.insert(index);
+            siblings.insert(index ^ 1);
+        }
+    }
+
+    std::vector<size_t> result;
+    for (auto it = siblings.rbegin(); it != siblings.rend(); ++it) {
+        if (computable.count(*it) == 0) {
+            result.push_back(*it);
+        }
+    }
+    return result;
+}
+
+std::vector<Digest> MerkleTree::authentication_structure(span<const size_t> leaf_indices) const {
+    std::vector<Digest> result;
+    for (size_t index : authentication_structure_node_indices(num_leafs_, leaf_indices)) {
+        result.push_back(nodes_[index]);
+    }
+    return result;
+}
+
+bool MerkleTree::verify(const Digest& root, size_t leaf_index, const Digest& leaf, span<const Digest> path) {
+    if (path.size() >= 8 * sizeof(size_t) || leaf_index >= (static_cast<size_t>(1) << path.size())) {
+        return false;
+    }
+
+    size_t index = (static_cast<size_t>(1) << path.size()) + leaf_index;
+    Digest acc = leaf;
+    for (const Digest& sibling : path) {
+        acc = (index & 1) == 0 ? Tip5Sponge::hash_pair(acc, sibling) : Tip5Sponge::hash_pair(sibling, acc);
+        index /= 2;
+    }
+    return acc == root;
+}
+
+bool MerkleTree::verify_batch(const Digest& root, size_t tree_height, span<const IndexedLeaf> leaves,
+                              span<const Digest> authentication_structure) {
+    if (tree_height >= 8 * sizeof(size_t)) {
+        return false;
+    }
+    size_t num_leafs = static_cast<size_t>(1) << tree_height;
+
+    std::vector<size_t> leaf_indices;
+    leaf_indices.reserve(leaves.size());
+    for (const auto& leaf : leaves) {
+        if (leaf.first >= num_leafs) {
+            return false;
+        }
+        leaf_indices.push_back(leaf.first);
+    }
+
+    std::vector<size_t> required = authentication_structure_node_indices(num_leafs, leaf_indices);
+    if (required.size() != authentication_structure.size()) {
+        return false;
+    }
+
+    // Known nodes by heap index; the same leaf given twice must agree
+    std::map<size_t, Digest> known;
+    for (const auto& leaf : leaves) {
+        auto inserted = known.emplace(num_leafs + leaf.first, leaf.second);
+        if (!inserted.second && inserted.first->second != leaf.second) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < required.size(); i++) {
+        known.emplace(required[i], authentication_structure[i]);
+    }
+
+    // Walk from the highest index down, so children are always ready before their parent
+    for (auto it = known.rbegin(); it != known.rend() && it->first > ROOT_INDEX; ++it) {
+        size_t index = it->first;
+        if ((index & 1) == 1 || known.count(index / 2) != 0) {
+            continue;
+        }
+        auto sibling = known.find(index + 1);
+        if (sibling == known.end()) {
+            return false;
+        }
+        known.emplace(index / 2, Tip5Sponge::hash_pair(it->second, sibling->second));
+    }
+
+    auto computed_root = known.find(ROOT_INDEX);
+    return computed_root != known.end() && computed_root->second == root;
+}
+
+} // namespace tip5xx
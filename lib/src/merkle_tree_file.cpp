@@ -0,0 +1,444 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/merkle_tree_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include "tip5xx/instrumentation.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/serialization.hpp"
+#include "tip5xx/tip5_hasher.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace tip5xx {
+
+namespace {
+
+using Format = MerkleTreeFileFormat;
+
+// Layers with fewer parents are hashed on the calling thread
+constexpr size_t MIN_PARENTS_PER_THREAD = 1024;
+
+// Encoded nodes buffered per depth before they are written out
+constexpr size_t WRITE_BUFFER_BYTES = size_t{1} << 20;
+
+// Highest tree whose file size DATA_OFFSET + 2 · 2^height · DIGEST_BYTES fits in 64 bits
+constexpr size_t MAX_HEIGHT = 56;
+static_assert((~uint64_t{0} - Format::DATA_OFFSET) / Format::DIGEST_BYTES / 2 >= (uint64_t{1} << MAX_HEIGHT),
+              "File size of the highest tree must not overflow");
+
+// Force the written contents of path to stable storage
+bool sync_file(const std::string& path) {
+#if defined(_WIN32)
+    int fd = _open(path.c_str(), _O_WRONLY | _O_BINARY);
+    if (fd < 0) {
+        return false;
+    }
+    bool synced = _commit(fd) == 0;
+    _close(fd);
+#else
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd < 0) {
+        return false;
+    }
+#if defined(__linux__)
+    bool synced = ::fdatasync(fd) == 0;
+#else
+    bool synced = ::fsync(fd) == 0;
+#endif
+    ::close(fd);
+#endif
+    return synced;
+}
+
+bool is_power_of_two(uint64_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+size_t log2_exact(uint64_t n) {
+    size_t log = 0;
+    while ((uint64_t{1} << log) < n) {
+        log++;
+    }
+    return log;
+}
+
+void store_le(uint8_t* out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint64_t load_le(const uint8_t* in, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+void encode_digest(const Digest& digest, uint8_t* out) {
+    encode_bytes(span<const BFieldElement>(digest.values().data(), Digest::LEN),
+                 span<uint8_t>(out, Format::DIGEST_BYTES));
+}
+
+Digest decode_digest(const uint8_t* in, uint64_t index) {
+    Digest digest;
+    if (!decode_bytes(span<const uint8_t>(in, Format::DIGEST_BYTES),
+                      span<BFieldElement>(digest.values().data(), Digest::LEN))) {
+        throw std::runtime_error("MerkleTreeFile: node " + std::to_string(index) + " is not canonical");
+    }
+    return digest;
+}
+
+uint64_t data_bytes(uint64_t num_leafs) {
+    return 2 * num_leafs * Format::DIGEST_BYTES;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------
+
+MerkleTreeFileWriter::MerkleTreeFileWriter(const std::string& path, uint64_t num_leafs, size_t num_threads)
+    : path_(path), num_leafs_(num_leafs), height_(0), chunk_height_(0), num_threads_(num_threads),
+      leaves_written_(0), finished_(false) {
+    if (!is_power_of_two(num_leafs_) || log2_exact(num_leafs_) > MAX_HEIGHT) {
+        throw std::invalid_argument("MerkleTreeFileWriter: number of leaves must be a non-zero power of two, got " +
+                                    std::to_string(num_leafs_));
+    }
+    height_ = log2_exact(num_leafs_);
+    chunk_height_ = std::min(height_, log2_exact(CHUNK_LEAVES));
+
+    file_.open(path_, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file_) {
+        throw std::runtime_error("MerkleTreeFileWriter: cannot create " + path_);
+    }
+    // Zeroed header page and unused node 0; the header is filled in by finish()
+    std::vector<char> zeros(Format::DATA_OFFSET + Format::DIGEST_BYTES, 0);
+    file_.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+    if (!file_) {
+        throw std::runtime_error("MerkleTreeFileWriter: cannot write " + path_);
+    }
+
+    chunk_.reserve(size_t{1} << chunk_height_);
+    pending_.resize(height_ + 1);
+    has_pending_.assign(height_ + 1, false);
+    buffers_.resize(height_ + 1);
+    buffer_start_.resize(height_ + 1);
+    for (size_t depth = 0; depth <= height_; depth++) {
+        buffer_start_[depth] = uint64_t{1} << depth;
+    }
+}
+
+MerkleTreeFileWriter::~MerkleTreeFileWriter() = default;
+
+void MerkleTreeFileWriter::append_leaf(const Digest& leaf) {
+    append_leaves(span<const Digest>(&leaf, 1));
+}
+
+void MerkleTreeFileWriter::append_leaves(span<const Digest> leaves) {
+    if (finished_) {
+        throw std::logic_error("MerkleTreeFileWriter: already finished");
+    }
+    if (leaves.size() > num_leafs_ - leaves_written_) {
+        throw std::length_error("MerkleTreeFileWriter: more than " + std::to_string(num_leafs_) + " leaves");
+    }
+    size_t chunk_leaves = size_t{1} << chunk_height_;
+    size_t offset = 0;
+    while (offset < leaves.size()) {
+        size_t take = std::min(leaves.size() - offset, chunk_leaves - chunk_.size());
+        chunk_.insert(chunk_.end(), leaves.begin() + offset, leaves.begin() + offset + take);
+        offset += take;
+        leaves_written_ += take;
+        if (chunk_.size() == chunk_leaves) {
+            hash_chunk();
+        }
+    }
+}
+
+void MerkleTreeFileWriter::append_leaf_bytes(const uint8_t* data, size_t length) {
+    append_leaf(Tip5Hasher::hash_bytes(data, length));
+}
+
+void MerkleTreeFileWriter::hash_chunk() {
+    TIP5XX_TRACE_SCOPE("tip5xx::MerkleTreeFileWriter::hash_chunk");
+    size_t depth = height_;
+    // A one-leaf chunk is its own root and is written by push()
+    if (chunk_.size() > 1) {
+        write_nodes(depth, span<const Digest>(chunk_.data(), chunk_.size()));
+    }
+
+    // Hash in place: layer of size n at the front of chunk_ yields n / 2 parents
+    std::vector<Digest> parents(chunk_.size() / 2);
+    for (size_t n = chunk_.size(); n > 1; n /= 2) {
+        const Digest* children = chunk_.data();
+        parallel_for(n / 2, MIN_PARENTS_PER_THREAD, [&](size_t begin, size_t end) {
+            Tip5Sponge::hash_layer(span<const Digest>(children + 2 * begin, 2 * (end - begin)),
+                                   span<Digest>(parents.data() + begin, end - begin));
+        }, num_threads_);
+        std::copy(parents.begin(), parents.begin() + n / 2, chunk_.begin());
+        depth--;
+        if (n / 2 > 1) {
+            write_nodes(depth, span<const Digest>(chunk_.data(), n / 2));
+        }
+    }
+    Digest chunk_root = chunk_[0];
+    chunk_.clear();
+    push(depth, chunk_root);
+}
+
+void MerkleTreeFileWriter::push(size_t depth, const Digest& node) {
+    // Write, then carry pairs upwards like a binary counter
+    Digest carry = node;
+    for (;;) {
+        write_node(depth, carry);
+        if (depth == 0) {
+            root_ = carry;
+            return;
+        }
+        if (!has_pending_[depth]) {
+            pending_[depth] = carry;
+            has_pending_[depth] = true;
+            return;
+        }
+        carry = Tip5Sponge::hash_pair(pending_[depth], carry);
+        has_pending_[depth] = false;
+        depth--;
+    }
+}
+
+void MerkleTreeFileWriter::write_node(size_t depth, const Digest& node) {
+    write_nodes(depth, span<const Digest>(&node, 1));
+}
+
+void MerkleTreeFileWriter::write_nodes(size_t depth, span<const Digest> nodes) {
+    std::vector<uint8_t>& buffer = buffers_[depth];
+    for (const Digest& node : nodes) {
+        size_t at = buffer.size();
+        buffer.resize(at + Format::DIGEST_BYTES);
+        encode_digest(node, buffer.data() + at);
+        if (buffer.size() >= WRITE_BUFFER_BYTES) {
+            flush(depth);
+        }
+    }
+}
+
+void MerkleTreeFileWriter::flush(size_t depth) {
+    std::vector<uint8_t>& buffer = buffers_[depth];
+    if (buffer.empty()) {
+        return;
+    }
+    file_.seekp(static_cast<std::streamoff>(Format::DATA_OFFSET + buffer_start_[depth] * Format::DIGEST_BYTES));
+    file_.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    if (!file_) {
+        throw std::runtime_error("MerkleTreeFileWriter: cannot write " + path_);
+    }
+    buffer_start_[depth] += buffer.size() / Format::DIGEST_BYTES;
+    buffer.clear();
+}
+
+Digest MerkleTreeFileWriter::finish() {
+    if (finished_) {
+        throw std::logic_error("MerkleTreeFileWriter: already finished");
+    }
+    if (leaves_written_ != num_leafs_) {
+        throw std::logic_error("MerkleTreeFileWriter: " + std::to_string(leaves_written_) + " of " +
+                               std::to_string(num_leafs_) + " leaves written");
+    }
+    for (size_t depth = 0; depth <= height_; depth++) {
+        flush(depth);
+    }
+    // Body must be on disk before the header marks the file complete
+    file_.flush();
+    if (!file_ || !sync_file(path_)) {
+        throw std::runtime_error("MerkleTreeFileWriter: cannot write " + path_);
+    }
+
+    uint8_t header[Format::HEADER_BYTES] = {};
+    std::memcpy(header, Format::MAGIC, sizeof(Format::MAGIC));
+    store_le(header + 8, Format::VERSION, 4);
+    store_le(header + 12, Format::DIGEST_BYTES, 4);
+    store_le(header + 16, height_, 8);
+    store_le(header + 24, num_leafs_, 8);
+    store_le(header + 32, Format::DATA_OFFSET, 8);
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file_.close();
+    if (!file_ || !sync_file(path_)) {
+        throw std::runtime_error("MerkleTreeFileWriter: cannot write " + path_);
+    }
+    finished_ = true;
+    return root_;
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------
+
+struct MerkleTreeFile::Storage {
+    std::string path;
+#if !defined(_WIN32)
+    int fd = -1;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    ~Storage() {
+        if (data != nullptr) {
+            munmap(const_cast<uint8_t*>(data), size);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    void open_file() {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("MerkleTreeFile: cannot open " + path);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            throw std::runtime_error("MerkleTreeFile: cannot stat " + path);
+        }
+        size = static_cast<size_t>(st.st_size);
+        if (size < Format::DATA_OFFSET) {
+            throw std::runtime_error("MerkleTreeFile: " + path + " is truncated");
+        }
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("MerkleTreeFile: cannot map " + path);
+        }
+        data = static_cast<const uint8_t*>(mapped);
+        // Path queries touch one node per level
+        madvise(mapped, size, MADV_RANDOM);
+    }
+
+    uint64_t file_size() const { return size; }
+
+    void read(uint64_t offset, uint8_t* out, size_t length) const {
+        std::memcpy(out, data + offset, length);
+    }
+#else
+    mutable std::ifstream file;
+    mutable std::mutex mutex;
+    uint64_t size = 0;
+
+    void open_file() {
+        file.open(path, std::ios::binary | std::ios::in);
+        if (!file) {
+            throw std::runtime_error("MerkleTreeFile: cannot open " + path);
+        }
+        file.seekg(0, std::ios::end);
+        size = static_cast<uint64_t>(file.tellg());
+        if (size < Format::DATA_OFFSET) {
+            throw std::runtime_error("MerkleTreeFile: " + path + " is truncated");
+        }
+    }
+
+    uint64_t file_size() const { return size; }
+
+    void read(uint64_t offset, uint8_t* out, size_t length) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(length));
+        if (!file) {
+            throw std::runtime_error("MerkleTreeFile: cannot read " + path);
+        }
+    }
+#endif
+};
+
+MerkleTreeFile::MerkleTreeFile(const std::string& path)
+    : storage_(new Storage()), num_leafs_(0), height_(0) {
+    storage_->path = path;
+    storage_->open_file();
+
+    uint8_t header[Format::HEADER_BYTES];
+    storage_->read(0, header, sizeof(header));
+    if (std::memcmp(header, Format::MAGIC, sizeof(Format::MAGIC)) != 0) {
+        throw std::runtime_error("MerkleTreeFile: " + path + " is not a complete Merkle tree file");
+    }
+    if (load_le(header + 8, 4) != Format::VERSION || load_le(header + 12, 4) != Format::DIGEST_BYTES ||
+        load_le(header + 32, 8) != Format::DATA_OFFSET) {
+        throw std::runtime_error("MerkleTreeFile: unsupported format in " + path);
+    }
+    uint64_t height = load_le(header + 16, 8);
+    uint64_t num_leafs = load_le(header + 24, 8);
+    if (height > MAX_HEIGHT || num_leafs != (uint64_t{1} << height)) {
+        throw std::runtime_error("MerkleTreeFile: inconsistent header in " + path);
+    }
+    if (storage_->file_size() < Format::DATA_OFFSET + data_bytes(num_leafs)) {
+        throw std::runtime_error("MerkleTreeFile: " + path + " is truncated");
+    }
+    height_ = static_cast<size_t>(height);
+    num_leafs_ = num_leafs;
+}
+
+MerkleTreeFile::~MerkleTreeFile() = default;
+MerkleTreeFile::MerkleTreeFile(MerkleTreeFile&& other) noexcept = default;
+MerkleTreeFile& MerkleTreeFile::operator=(MerkleTreeFile&& other) noexcept = default;
+
+Digest MerkleTreeFile::node(uint64_t index) const {
+    if (index == 0 || index >= 2 * num_leafs_) {
+        throw std::out_of_range("MerkleTreeFile: node index " + std::to_string(index) + " out of range");
+    }
+    uint8_t bytes[Format::DIGEST_BYTES];
+    storage_->read(Format::DATA_OFFSET + index * Format::DIGEST_BYTES, bytes, sizeof(bytes));
+    return decode_digest(bytes, index);
+}
+
+Digest MerkleTreeFile::leaf(uint64_t index) const {
+    if (index >= num_leafs_) {
+        throw std::out_of_range("MerkleTreeFile: leaf index " + std::to_string(index) + " out of range");
+    }
+    return node(num_leafs_ + index);
+}
+
+std::vector<Digest> MerkleTreeFile::authentication_path(uint64_t leaf_index) const {
+    if (leaf_index >= num_leafs_) {
+        throw std::out_of_range("MerkleTreeFile: leaf index " + std::to_string(leaf_index) + " out of range");
+    }
+
+    std::vector<Digest> path;
+    path.reserve(height_);
+    for (uint64_t index = num_leafs_ + leaf_index; index > 1; index /= 2) {
+        path.push_back(node(index ^ 1));
+    }
+    return path;
+}
+
+} // namespace tip5xx
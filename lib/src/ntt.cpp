@@ -0,0 +1,381 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/ntt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include "tip5xx/instrumentation.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/scratch_arena.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+static_assert(sizeof(BFieldElement) == sizeof(uint64_t), "BFieldElement must be a single machine word");
+static_assert(std::is_standard_layout_v<BFieldElement>, "BFieldElement must be standard layout");
+static_assert((size_t{1} << Ntt::FOUR_STEP_LOG2_THRESHOLD) <= Ntt::PARALLEL_THRESHOLD,
+              "Only the four-step path is multithreaded");
+
+constexpr size_t MAX_LOG2_SIZE = BFieldElement::MAX_TWO_ADICITY;
+
+// Rows handed to one thread at a time in the four-step passes
+constexpr size_t MIN_ROWS_PER_THREAD = 16;
+
+// Side of the square tiles used for out-of-place transposition
+constexpr size_t TRANSPOSE_TILE = 16;
+
+// Twiddles per chunk when filling a table level in parallel; each chunk is
+// seeded with two mod_pow calls
+constexpr size_t MIN_TWIDDLES_PER_THREAD = size_t{1} << 14;
+
+// Raw (Montgomery form) field arithmetic, mirrors BFieldElement operators
+inline uint64_t add_raw(uint64_t a, uint64_t b) {
+    uint64_t x1;
+    bool c1 = __builtin_sub_overflow(a, BFieldElement::P - b, &x1);
+    return c1 ? x1 + BFieldElement::P : x1;
+}
+
+inline uint64_t sub_raw(uint64_t a, uint64_t b) {
+    uint64_t x1;
+    bool c1 = __builtin_sub_overflow(a, b, &x1);
+    return c1 ? x1 + BFieldElement::P : x1;
+}
+
+inline uint64_t mul_raw(uint64_t a, uint64_t b) {
+    return BFieldElement::montyred(static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b));
+}
+
+uint64_t* raw(span<BFieldElement> s) {
+    return reinterpret_cast<uint64_t*>(s.data());
+}
+
+// Twiddle factors of one domain size. For the butterfly stage that combines
+// halves of size m, the factors ω_{2m}^j, j < m, are stored at [m, 2m).
+struct Twiddles {
+    std::vector<uint64_t> forward;
+    std::vector<uint64_t> inverse;
+};
+
+std::unique_ptr<const Twiddles> make_twiddles(size_t log_n) {
+    size_t n = size_t{1} << log_n;
+    auto twiddles = std::make_unique<Twiddles>();
+    twiddles->forward.resize(std::max<size_t>(n, 2));
+    twiddles->inverse.resize(std::max<size_t>(n, 2));
+
+    for (size_t m = 1; m < n; m <<= 1) {
+        BFieldElement root = BFieldElement::primitive_root_of_unity(2 * m);
+        BFieldElement root_inverse = root.inverse();
+        parallel_for(m, MIN_TWIDDLES_PER_THREAD, [&](size_t begin, size_t end) {
+            BFieldElement w = root.mod_pow(begin);
+            BFieldElement w_inverse = root_inverse.mod_pow(begin);
+            for (size_t j = begin; j < end; j++) {
+                twiddles->forward[m + j] = w.raw_u64();
+                twiddles->inverse[m + j] = w_inverse.raw_u64();
+                w *= root;
+                w_inverse *= root_inverse;
+            }
+        });
+    }
+    return twiddles;
+}
+
+// Tables are built without holding any lock: make_twiddles submits executor
+// work, and a task of another batch may itself be waiting for this table.
+// Threads racing on a first use each build one and the first to publish wins.
+const Twiddles& twiddles_for(size_t log_n) {
+    static std::array<std::atomic<const Twiddles*>, MAX_LOG2_SIZE + 1> published{};
+    static std::array<std::unique_ptr<const Twiddles>, MAX_LOG2_SIZE + 1> tables;
+    static std::mutex publish_mutex;
+
+    if (const Twiddles* twiddles = published[log_n].load(std::memory_order_acquire)) {
+        return *twiddles;
+    }
+    std::unique_ptr<const Twiddles> built = make_twiddles(log_n);
+
+    std::lock_guard<std::mutex> lock(publish_mutex);
+    if (!tables[log_n]) {
+        tables[log_n] = std::move(built);
+        published[log_n].store(tables[log_n].get(), std::memory_order_release);
+    }
+    return *tables[log_n];
+}
+
+size_t checked_log2(size_t n) {
+    if (n == 0 || (n & (n - 1)) != 0) {
+        throw std::invalid_argument("NTT size must be a power of two");
+    }
+    size_t log_n = static_cast<size_t>(__builtin_ctzll(n));
+    if (log_n > MAX_LOG2_SIZE) {
+        throw std::invalid_argument("NTT size exceeds 2^32");
+    }
+    return log_n;
+}
+
+void bit_reverse_permute(uint64_t* x, size_t n) {
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(x[i], x[j]);
+        }
+    }
+}
+
+// Iterative decimation in time: bit reversal, an optional radix-2 stage for
+// odd log_n, then radix-4 passes that each fuse the stages m and 2m
+void transform_in_cache(uint64_t* x, size_t log_n, const uint64_t* tw) {
+    size_t n = size_t{1} << log_n;
+    if (n == 1) {
+        return;
+    }
+    bit_reverse_permute(x, n);
+
+    size_t m = 1;
+    if (log_n & 1) {
+        for (size_t k = 0; k < n; k += 2) {
+            uint64_t u = x[k];
+            uint64_t v = x[k + 1];
+            x[k] = add_raw(u, v);
+            x[k + 1] = sub_raw(u, v);
+        }
+        m = 2;
+    }
+
+    for (; m < n; m <<= 2) {
+        for (size_t k = 0; k < n; k += 4 * m) {
+            uint64_t* block = x + k;
+            for (size_t j = 0; j < m; j++) {
+                uint64_t w1 = tw[m + j];
+                uint64_t w2 = tw[2 * m + j];
+                uint64_t w3 = tw[3 * m + j];
+
+                uint64_t a0 = block[j];
+                uint64_t a1 = mul_raw(block[j + m], w1);
+                uint64_t a2 = block[j + 2 * m];
+                uint64_t a3 = mul_raw(block[j + 3 * m], w1);
+
+                uint64_t b0 = add_raw(a0, a1);
+                uint64_t b1 = sub_raw(a0, a1);
+                uint64_t b2 = mul_raw(add_raw(a2, a3), w2);
+                uint64_t b3 = mul_raw(sub_raw(a2, a3), w3);
+
+                block[j] = add_raw(b0, b2);
+                block[j + 2 * m] = sub_raw(b0, b2);
+                block[j + m] = add_raw(b1, b3);
+                block[j + 3 * m] = sub_raw(b1, b3);
+            }
+        }
+    }
+}
+
+// dst (cols x rows) = transpose of src (rows x cols), tiled for cache reuse
+void transpose(const uint64_t* src, uint64_t* dst, size_t rows, size_t cols, size_t num_threads) {
+    size_t row_tiles = (rows + TRANSPOSE_TILE - 1) / TRANSPOSE_TILE;
+    parallel_for(row_tiles, MIN_ROWS_PER_THREAD / TRANSPOSE_TILE + 1, [&](size_t begin, size_t end) {
+        for (size_t rt = begin; rt < end; rt++) {
+            size_t r0 = rt * TRANSPOSE_TILE;
+            size_t r1 = std::min(rows, r0 + TRANSPOSE_TILE);
+            for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_TILE) {
+                size_t c1 = std::min(cols, c0 + TRANSPOSE_TILE);
+                for (size_t r = r0; r < r1; r++) {
+                    for (size_t c = c0; c < c1; c++) {
+                        dst[c * rows + r] = src[r * cols + c];
+                    }
+                }
+            }
+        }
+    }, num_threads);
+}
+
+// Four-step (Bailey) transform of n = R · C points. With j = C·j1 + j2 and
+// k = k1 + R·k2, X[k] = Σ_{j2} ω_C^{j2·k2} · ω_n^{j2·k1} · Σ_{j1} ω_R^{j1·k1} · x[j]:
+// R-point transforms on the columns, a twiddle scaling, C-point transforms
+// on the rows and a final transposition. Columns are transposed into rows so
+// every sub-transform runs on contiguous memory.
+void transform_four_step(uint64_t* x, size_t log_n, bool inverse, size_t num_threads) {
+    size_t n = size_t{1} << log_n;
+    size_t log_r = log_n / 2;
+    size_t log_c = log_n - log_r;
+    size_t rows = size_t{1} << log_r;
+    size_t cols = size_t{1} << log_c;
+
+    const Twiddles& tw_r = twiddles_for(log_r);
+    const Twiddles& tw_c = twiddles_for(log_c);
+    const uint64_t* row_twiddles = inverse ? tw_r.inverse.data() : tw_r.forward.data();
+    const uint64_t* col_twiddles = inverse ? tw_c.inverse.data() : tw_c.forward.data();
+
+    BFieldElement root = BFieldElement::primitive_root_of_unity(n);
+    if (inverse) {
+        root = root.inverse();
+    }
+
+    auto scratch = ScratchArena::global().borrow<uint64_t>(n);
+    uint64_t* t = scratch.data();
+
+    // Column j2 of x becomes row j2 of t
+    transpose(x, t, rows, cols, num_threads);
+
+    parallel_for(cols, MIN_ROWS_PER_THREAD, [&](size_t begin, size_t end) {
+        for (size_t j2 = begin; j2 < end; j2++) {
+            uint64_t* row = t + j2 * rows;
+            transform_in_cache(row, log_r, row_twiddles);
+
+            uint64_t step = root.mod_pow(j2).raw_u64();
+            uint64_t w = BFieldElement::ONE.raw_u64();
+            for (size_t k1 = 0; k1 < rows; k1++) {
+                row[k1] = mul_raw(row[k1], w);
+                w = mul_raw(w, step);
+            }
+        }
+    }, num_threads);
+
+    transpose(t, x, cols, rows, num_threads);
+
+    parallel_for(rows, MIN_ROWS_PER_THREAD, [&](size_t begin, size_t end) {
+        for (size_t k1 = begin; k1 < end; k1++) {
+            transform_in_cache(x + k1 * cols, log_c, col_twiddles);
+        }
+    }, num_threads);
+
+    // x[k1·C + k2] holds X[k1 + R·k2]
+    transpose(x, t, rows, cols, num_threads);
+    std::copy(t, t + n, x);
+}
+
+void transform(span<BFieldElement> values, bool inverse, size_t num_threads) {
+    size_t log_n = checked_log2(values.size());
+    size_t n = values.size();
+    uint64_t* x = raw(values);
+    TIP5XX_TRACE_SCOPE(inverse ? "tip5xx::Ntt::inverse" : "tip5xx::Ntt::forward");
+
+    if (log_n < Ntt::FOUR_STEP_LOG2_THRESHOLD) {
+        const Twiddles& tw = twiddles_for(log_n);
+        transform_in_cache(x, log_n, inverse ? tw.inverse.data() : tw.forward.data());
+    } else {
+        size_t threads = n >= Ntt::PARALLEL_THRESHOLD ? num_threads : 1;
+        transform_four_step(x, log_n, inverse, threads);
+    }
+
+    if (inverse) {
+        uint64_t n_inverse = BFieldElement::new_element(n).inverse().raw_u64();
+        size_t threads = n >= Ntt::PARALLEL_THRESHOLD ? num_threads : 1;
+        parallel_for(n, Ntt::PARALLEL_THRESHOLD / 16, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                x[i] = mul_raw(x[i], n_inverse);
+            }
+        }, threads);
+    }
+}
+
+// values[i] *= scale^i
+void scale_by_powers(span<BFieldElement> values, BFieldElement scale, size_t num_threads) {
+    size_t n = values.size();
+    size_t threads = n >= Ntt::PARALLEL_THRESHOLD ? num_threads : 1;
+    uint64_t* x = raw(values);
+    uint64_t s = scale.raw_u64();
+
+    parallel_for(n, Ntt::PARALLEL_THRESHOLD / 16, [&](size_t begin, size_t end) {
+        uint64_t w = scale.mod_pow(begin).raw_u64();
+        for (size_t i = begin; i < end; i++) {
+            x[i] = mul_raw(x[i], w);
+            w = mul_raw(w, s);
+        }
+    }, threads);
+}
+
+} // namespace
+
+void Ntt::forward(span<BFieldElement> values, size_t num_threads) {
+    transform(values, false, num_threads);
+}
+
+void Ntt::inverse(span<BFieldElement> values, size_t num_threads) {
+    transform(values, true, num_threads);
+}
+
+void Ntt::coset_forward(span<BFieldElement> values, BFieldElement offset, size_t num_threads) {
+    checked_log2(values.size());
+    scale_by_powers(values, offset, num_threads);
+    forward(values, num_threads);
+}
+
+void Ntt::coset_inverse(span<BFieldElement> values, BFieldElement offset, size_t num_threads) {
+    inverse(values, num_threads);
+    scale_by_powers(values, offset.inverse(), num_threads);
+}
+
+std::vector<BFieldElement> Ntt::low_degree_extension(span<const BFieldElement> evaluations,
+                                                     size_t expansion_factor,
+                                                     BFieldElement offset,
+                                                     size_t num_threads) {
+    size_t log_n = checked_log2(evaluations.size());
+    size_t log_factor = checked_log2(expansion_factor);
+    if (log_n + log_factor > MAX_LOG2_SIZE) {
+        throw std::invalid_argument("NTT size exceeds 2^32");
+    }
+
+    std::vector<BFieldElement> extended(evaluations.size() * expansion_factor);
+    low_degree_extension(evaluations, extended, offset, num_threads);
+    return extended;
+}
+
+void Ntt::low_degree_extension(span<const BFieldElement> evaluations,
+                               span<BFieldElement> out,
+                               BFieldElement offset,
+                               size_t num_threads) {
+    size_t log_n = checked_log2(evaluations.size());
+    if (out.size() % evaluations.size() != 0) {
+        throw std::invalid_argument("low_degree_extension: output size must be a multiple of the input size");
+    }
+    size_t log_factor = checked_log2(out.size() / evaluations.size());
+    if (log_n + log_factor > MAX_LOG2_SIZE) {
+        throw std::invalid_argument("NTT size exceeds 2^32");
+    }
+
+    std::copy(evaluations.begin(), evaluations.end(), out.begin());
+    std::fill(out.begin() + evaluations.size(), out.end(), BFieldElement::ZERO);
+
+    inverse(out.first(evaluations.size()), num_threads);
+    coset_forward(out, offset, num_threads);
+}
+
+void Ntt::precompute_twiddles(size_t n) {
+    size_t log_n = checked_log2(n);
+    if (log_n < FOUR_STEP_LOG2_THRESHOLD) {
+        twiddles_for(log_n);
+    } else {
+        twiddles_for(log_n / 2);
+        twiddles_for(log_n - log_n / 2);
+    }
+}
+
+} // namespace tip5xx
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+namespace tip5xx {
+
+namespace {
+
+// Chunks per thread, so threads that finish early can steal from slower ones
+constexpr size_t CHUNKS_PER_THREAD = 4;
+
+} // namespace
+
+size_t default_thread_count() {
+    return default_executor()->concurrency();
+}
+
+void parallel_for(size_t n, size_t min_chunk, const std::function<void(size_t, size_t)>& fn,
+                  size_t num_threads) {
+    if (n == 0) {
+        return;
+    }
+    parallel_for(*default_executor(), n, min_chunk, fn, num_threads);
+}
+
+void parallel_for(Executor& executor, size_t n, size_t min_chunk,
+                  const std::function<void(size_t, size_t)>& fn, size_t num_threads) {
+    if (n == 0) {
+        return;
+    }
+
+    size_t threads = std::min(num_threads == 0 ? executor.concurrency() : num_threads, executor.concurrency());
+    size_t max_chunks = std::max<size_t>(1, n / std::max<size_t>(1, min_chunk));
+    if (threads <= 1 || max_chunks <= 1) {
+        fn(0, n);
+        return;
+    }
+    size_t chunks = std::min(threads * CHUNKS_PER_THREAD, max_chunks);
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    // Chunk c covers [c * n / chunks, (c + 1) * n / chunks)
+    executor.bulk(chunks, [&](size_t c) {
+        try {
+            fn(c * n / chunks, (c + 1) * n / chunks);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }, threads);
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace tip5xx
@@ -0,0 +1,602 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/polynomial.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include "tip5xx/b_field_accumulator.hpp"
+#include "tip5xx/ntt.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/scratch_arena.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+using Coefficients = std::vector<BFieldElement>;
+
+// Divisions with a shorter divisor or quotient are done by long division
+constexpr size_t NEWTON_DIVISION_THRESHOLD = 64;
+
+// Multi-point evaluations with fewer point-coefficient pairs use Horner's rule
+constexpr size_t MIN_TREE_EVALUATION_WORK = size_t{1} << 17;
+
+// Points handled per thread when evaluating or forming the barycentric sum
+constexpr size_t MIN_POINTS_PER_THREAD = 1 << 14;
+
+size_t next_power_of_two(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// out[0 .. na + nb - 1) = a · b, each coefficient a single lazily reduced sum
+void naive_product(const BFieldElement* a, size_t na, const BFieldElement* b, size_t nb, BFieldElement* out) {
+    for (size_t k = 0; k + 1 < na + nb; k++) {
+        size_t lo = k + 1 > nb ? k + 1 - nb : 0;
+        size_t hi = std::min(k, na - 1);
+        BFieldAccumulator acc;
+        for (size_t i = lo; i <= hi; i++) {
+            acc.mul_add(a[i], b[k - i]);
+        }
+        out[k] = acc.reduce();
+    }
+}
+
+void karatsuba_product(const BFieldElement* a, size_t na, const BFieldElement* b, size_t nb, BFieldElement* out) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < Polynomial<BFieldElement>::KARATSUBA_THRESHOLD) {
+        naive_product(a, na, b, nb, out);
+        return;
+    }
+
+    size_t n = na + nb - 1;
+    // a = a0 + x^h a1, b = b0 + x^h b1 needs nb > h
+    size_t h = (na + 1) / 2;
+    if (nb <= h) {
+        // Unbalanced: multiply b by nb-sized slices of a
+        std::fill(out, out + n, BFieldElement::ZERO);
+        Coefficients slice(2 * nb - 1);
+        for (size_t offset = 0; offset < na; offset += nb) {
+            size_t len = std::min(nb, na - offset);
+            karatsuba_product(a + offset, len, b, nb, slice.data());
+            for (size_t i = 0; i + 1 < len + nb; i++) {
+                out[offset + i] += slice[i];
+            }
+        }
+        return;
+    }
+
+    size_t na1 = na - h;
+    size_t nb1 = nb - h;
+
+    Coefficients z0(2 * h - 1);
+    karatsuba_product(a, h, b, h, z0.data());
+    Coefficients z2(na1 + nb1 - 1);
+    karatsuba_product(a + h, na1, b + h, nb1, z2.data());
+
+    Coefficients sa(a, a + h);
+    Coefficients sb(b, b + h);
+    for (size_t i = 0; i < na1; i++) {
+        sa[i] += a[h + i];
+    }
+    for (size_t i = 0; i < nb1; i++) {
+        sb[i] += b[h + i];
+    }
+    Coefficients z1(2 * h - 1);
+    karatsuba_product(sa.data(), h, sb.data(), h, z1.data());
+    for (size_t i = 0; i < z0.size(); i++) {
+        z1[i] -= z0[i];
+    }
+    for (size_t i = 0; i < z2.size(); i++) {
+        z1[i] -= z2[i];
+    }
+
+    std::fill(out, out + n, BFieldElement::ZERO);
+    std::copy(z0.begin(), z0.end(), out);
+    for (size_t i = 0; i < z2.size(); i++) {
+        out[2 * h + i] += z2[i];
+    }
+    // z1 has at most n - h nonzero terms
+    for (size_t i = 0; i < z1.size() && h + i < n; i++) {
+        out[h + i] += z1[i];
+    }
+}
+
+Coefficients ntt_product(const Coefficients& a, const Coefficients& b) {
+    size_t n = a.size() + b.size() - 1;
+    size_t size = next_power_of_two(n);
+    Coefficients fa(size, BFieldElement::ZERO);
+    Coefficients fb(size, BFieldElement::ZERO);
+    std::copy(a.begin(), a.end(), fa.begin());
+    std::copy(b.begin(), b.end(), fb.begin());
+    Ntt::forward(fa);
+    Ntt::forward(fb);
+    for (size_t i = 0; i < size; i++) {
+        fa[i] *= fb[i];
+    }
+    Ntt::inverse(fa);
+    fa.resize(n);
+    return fa;
+}
+
+Coefficients product(const Coefficients& a, const Coefficients& b) {
+    if (a.empty() || b.empty()) {
+        return {};
+    }
+    const Coefficients& longer = a.size() >= b.size() ? a : b;
+    const Coefficients& shorter = a.size() >= b.size() ? b : a;
+    size_t n = a.size() + b.size() - 1;
+    Coefficients out(n);
+    if (shorter.size() < Polynomial<BFieldElement>::KARATSUBA_THRESHOLD) {
+        naive_product(longer.data(), longer.size(), shorter.data(), shorter.size(), out.data());
+    } else if (longer.size() >= 2 * shorter.size()) {
+        // Balanced products of shorter-sized slices keep transforms small
+        std::fill(out.begin(), out.end(), BFieldElement::ZERO);
+        for (size_t offset = 0; offset < longer.size(); offset += shorter.size()) {
+            size_t len = std::min(shorter.size(), longer.size() - offset);
+            Coefficients slice(longer.begin() + static_cast<std::ptrdiff_t>(offset),
+                               longer.begin() + static_cast<std::ptrdiff_t>(offset + len));
+            Coefficients part = product(slice, shorter);
+            for (size_t i = 0; i < part.size(); i++) {
+                out[offset + i] += part[i];
+            }
+        }
+    } else if (n < Polynomial<BFieldElement>::NTT_THRESHOLD) {
+        karatsuba_product(a.data(), a.size(), b.data(), b.size(), out.data());
+    } else {
+        out = ntt_product(a, b);
+    }
+    return out;
+}
+
+// a · b mod x^n
+Coefficients truncated_product(const Coefficients& a, const Coefficients& b, size_t n) {
+    Coefficients lhs(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(std::min(a.size(), n)));
+    Coefficients rhs(b.begin(), b.begin() + static_cast<std::ptrdiff_t>(std::min(b.size(), n)));
+    Coefficients out = product(lhs, rhs);
+    out.resize(n, BFieldElement::ZERO);
+    return out;
+}
+
+// 1 / f mod x^n by Newton iteration g ← g · (2 - f · g); f[0] must be non-zero
+Coefficients series_inverse(const Coefficients& f, size_t n) {
+    Coefficients g = {f[0].inverse()};
+    for (size_t precision = 1; precision < n;) {
+        precision = std::min(2 * precision, n);
+        Coefficients e = truncated_product(f, g, precision);
+        for (auto& c : e) {
+            c = -c;
+        }
+        e[0] += BFieldElement::new_element(2);
+        g = truncated_product(g, e, precision);
+    }
+    return g;
+}
+
+// Horner's rule
+BFieldElement horner(const Coefficients& coefficients, const BFieldElement& x) {
+    BFieldElement acc = BFieldElement::ZERO;
+    for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+        acc = acc * x + *it;
+    }
+    return acc;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Subproduct tree
+// ---------------------------------------------------------------------------
+
+// Products Π (x - points[i]) over a balanced binary split of the points
+template <typename FF>
+class Polynomial<FF>::SubproductTree {
+public:
+    explicit SubproductTree(span<const FF> points) : points_(points) {
+        nodes_.reserve(4 * (points.size() / TREE_LEAF_SIZE + 1));
+        build(0, points.size());
+    }
+
+    const Polynomial& root() const { return nodes_[0].product; }
+
+    // out[i] = p(points[i])
+    void evaluate(const Polynomial& p, span<FF> out) const { evaluate(0, p, out); }
+
+    // Σ weights[i] · root() / (x - points[i])
+    Polynomial combine(span<const FF> weights) const { return combine(0, weights); }
+
+private:
+    struct Node {
+        size_t begin;
+        size_t end;
+        size_t left;
+        size_t right;
+        Polynomial product;
+    };
+
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    size_t build(size_t begin, size_t end) {
+        size_t index = nodes_.size();
+        nodes_.push_back(Node{begin, end, NONE, NONE, Polynomial()});
+        if (end - begin <= TREE_LEAF_SIZE) {
+            // Multiply the linear factors in one by one
+            std::vector<FF> c = {FF::one()};
+            for (size_t i = begin; i < end; i++) {
+                c.push_back(FF::zero());
+                for (size_t k = c.size() - 1; k > 0; k--) {
+                    c[k] = c[k - 1] - c[k] * points_[i];
+                }
+                c[0] = -(c[0] * points_[i]);
+            }
+            nodes_[index].product = Polynomial(std::move(c));
+            return index;
+        }
+        size_t mid = begin + (end - begin) / 2;
+        size_t left = build(begin, mid);
+        size_t right = build(mid, end);
+        nodes_[index].left = left;
+        nodes_[index].right = right;
+        nodes_[index].product = nodes_[left].product * nodes_[right].product;
+        return index;
+    }
+
+    void evaluate(size_t index, const Polynomial& p, span<FF> out) const {
+        const Node& node = nodes_[index];
+        Polynomial remainder = p.degree() >= node.product.degree() ? p.divide(node.product).second : p;
+        if (node.left == NONE) {
+            for (size_t i = node.begin; i < node.end; i++) {
+                out[i] = remainder.evaluate(points_[i]);
+            }
+            return;
+        }
+        evaluate(node.left, remainder, out);
+        evaluate(node.right, remainder, out);
+    }
+
+    Polynomial combine(size_t index, span<const FF> weights) const {
+        const Node& node = nodes_[index];
+        if (node.left == NONE) {
+            // Σ w_i · product / (x - x_i), each quotient by synthetic division
+            const std::vector<FF>& m = node.product.coefficients();
+            size_t n = node.end - node.begin;
+            std::vector<FF> sum(n, FF::zero());
+            std::vector<FF> quotient(n);
+            for (size_t i = node.begin; i < node.end; i++) {
+                FF carry = FF::zero();
+                for (size_t k = n; k > 0; k--) {
+                    carry = m[k] + carry * points_[i];
+                    quotient[k - 1] = carry;
+                }
+                for (size_t k = 0; k < n; k++) {
+                    sum[k] += weights[i] * quotient[k];
+                }
+            }
+            return Polynomial(std::move(sum));
+        }
+        return combine(node.left, weights) * nodes_[node.right].product +
+               combine(node.right, weights) * nodes_[node.left].product;
+    }
+
+    span<const FF> points_;
+    std::vector<Node> nodes_;
+};
+
+// ---------------------------------------------------------------------------
+// Polynomial
+// ---------------------------------------------------------------------------
+
+template <typename FF>
+Polynomial<FF>::Polynomial(std::vector<FF> coefficients) : coefficients_(std::move(coefficients)) {
+    normalize();
+}
+
+template <typename FF>
+void Polynomial<FF>::normalize() {
+    while (!coefficients_.empty() && coefficients_.back().is_zero()) {
+        coefficients_.pop_back();
+    }
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::constant(const FF& value) {
+    return Polynomial(std::vector<FF>{value});
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::x_to_the(size_t n) {
+    std::vector<FF> c(n + 1, FF::zero());
+    c[n] = FF::one();
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::zerofier(span<const FF> roots) {
+    if (roots.empty()) {
+        return constant(FF::one());
+    }
+    return SubproductTree(roots).root();
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::interpolate(span<const FF> xs, span<const FF> ys) {
+    if (xs.size() != ys.size()) {
+        throw std::invalid_argument("Polynomial::interpolate: " + std::to_string(xs.size()) + " points but " +
+                                    std::to_string(ys.size()) + " values");
+    }
+    if (xs.empty()) {
+        return Polynomial();
+    }
+
+    // Lagrange weights y_i / M'(x_i) for M = Π (x - x_i)
+    SubproductTree tree(xs);
+    std::vector<FF> weights(xs.size());
+    tree.evaluate(tree.root().formal_derivative(), weights);
+    for (size_t i = 0; i < weights.size(); i++) {
+        if (weights[i].is_zero()) {
+            throw std::invalid_argument("Polynomial::interpolate: repeated point " + xs[i].to_string());
+        }
+    }
+    FF::batch_inversion_in_place(weights);
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] *= ys[i];
+    }
+    return tree.combine(weights);
+}
+
+template <typename FF>
+FF Polynomial<FF>::barycentric_evaluate(span<const FF> codeword, const FF& x) {
+    size_t n = codeword.size();
+    if (n == 0 || (n & (n - 1)) != 0) {
+        throw std::invalid_argument("Polynomial::barycentric_evaluate: codeword length must be a power of two, got " +
+                                    std::to_string(n));
+    }
+    FF omega = FF::primitive_root_of_unity(n);
+
+    // ω^i and x - ω^i, chunks seeded with ω^begin
+    auto lease_powers = ScratchArena::global().borrow<FF>(n);
+    auto lease_differences = ScratchArena::global().borrow<FF>(n);
+    span<FF> powers = lease_powers.view();
+    span<FF> differences = lease_differences.view();
+    parallel_for(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+        FF power = omega.mod_pow(begin);
+        for (size_t i = begin; i < end; i++) {
+            powers[i] = power;
+            differences[i] = x - power;
+            power *= omega;
+        }
+    });
+    for (size_t i = 0; i < n; i++) {
+        if (differences[i].is_zero()) {
+            return codeword[i];
+        }
+    }
+    FF::batch_inversion_in_place(differences);
+
+    // p(x) = (x^n - 1) / n · Σ y_i · ω^i / (x - ω^i)
+    BFieldAccumulator acc;
+    for (size_t i = 0; i < n; i++) {
+        acc.mul_add(codeword[i], powers[i] * differences[i]);
+    }
+    FF scale = (x.mod_pow(n) - FF::one()) * FF::new_element(n).inverse();
+    return acc.reduce() * scale;
+}
+
+template <typename FF>
+FF Polynomial<FF>::leading_coefficient() const {
+    return coefficients_.empty() ? FF::zero() : coefficients_.back();
+}
+
+template <typename FF>
+FF Polynomial<FF>::evaluate(const FF& x) const {
+    return horner(coefficients_, x);
+}
+
+template <typename FF>
+std::vector<FF> Polynomial<FF>::batch_evaluate(span<const FF> xs) const {
+    std::vector<FF> out(xs.size());
+    if (xs.size() <= TREE_LEAF_SIZE || coefficients_.size() <= TREE_LEAF_SIZE ||
+        xs.size() * coefficients_.size() < MIN_TREE_EVALUATION_WORK) {
+        parallel_for(xs.size(), MIN_POINTS_PER_THREAD / (coefficients_.size() + 1) + 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = evaluate(xs[i]);
+            }
+        });
+        return out;
+    }
+    SubproductTree(xs).evaluate(*this, out);
+    return out;
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::formal_derivative() const {
+    std::vector<FF> c;
+    if (coefficients_.size() > 1) {
+        c.reserve(coefficients_.size() - 1);
+        for (size_t i = 1; i < coefficients_.size(); i++) {
+            c.push_back(coefficients_[i] * FF::new_element(i));
+        }
+    }
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::scale(const FF& factor) const {
+    std::vector<FF> c(coefficients_);
+    FF power = FF::one();
+    for (auto& coefficient : c) {
+        coefficient *= power;
+        power *= factor;
+    }
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+std::pair<Polynomial<FF>, Polynomial<FF>> Polynomial<FF>::divide(const Polynomial& divisor) const {
+    if (divisor.is_zero()) {
+        throw std::invalid_argument("Polynomial::divide: division by the zero polynomial");
+    }
+    if (degree() < divisor.degree()) {
+        return {Polynomial(), *this};
+    }
+
+    const std::vector<FF>& a = coefficients_;
+    const std::vector<FF>& b = divisor.coefficients_;
+    size_t quotient_len = a.size() - b.size() + 1;
+
+    if (b.size() < NEWTON_DIVISION_THRESHOLD || quotient_len < NEWTON_DIVISION_THRESHOLD) {
+        std::vector<FF> remainder(a);
+        std::vector<FF> quotient(quotient_len);
+        FF lead_inverse = b.back().inverse();
+        for (size_t k = quotient_len; k > 0; k--) {
+            FF q = remainder[k - 1 + b.size() - 1] * lead_inverse;
+            quotient[k - 1] = q;
+            for (size_t j = 0; j < b.size(); j++) {
+                remainder[k - 1 + j] -= q * b[j];
+            }
+        }
+        remainder.resize(b.size() - 1);
+        return {Polynomial(std::move(quotient)), Polynomial(std::move(remainder))};
+    }
+
+    // rev(q) = rev(a) / rev(b) mod x^quotient_len
+    std::vector<FF> reversed_a(a.rbegin(), a.rend());
+    std::vector<FF> reversed_b(b.rbegin(), b.rend());
+    std::vector<FF> reversed_q = truncated_product(reversed_a, series_inverse(reversed_b, quotient_len), quotient_len);
+    std::vector<FF> quotient(reversed_q.rbegin(), reversed_q.rend());
+
+    // r = a - q · b, of which only the low deg(b) coefficients are non-zero
+    std::vector<FF> qb = truncated_product(quotient, b, b.size() - 1);
+    std::vector<FF> remainder(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(b.size() - 1));
+    for (size_t i = 0; i < remainder.size(); i++) {
+        remainder[i] -= qb[i];
+    }
+    return {Polynomial(std::move(quotient)), Polynomial(std::move(remainder))};
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::naive_multiply(const Polynomial& a, const Polynomial& b) {
+    if (a.is_zero() || b.is_zero()) {
+        return Polynomial();
+    }
+    std::vector<FF> out(a.coefficients_.size() + b.coefficients_.size() - 1);
+    naive_product(a.coefficients_.data(), a.coefficients_.size(), b.coefficients_.data(), b.coefficients_.size(),
+                  out.data());
+    return Polynomial(std::move(out));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::karatsuba_multiply(const Polynomial& a, const Polynomial& b) {
+    if (a.is_zero() || b.is_zero()) {
+        return Polynomial();
+    }
+    std::vector<FF> out(a.coefficients_.size() + b.coefficients_.size() - 1);
+    karatsuba_product(a.coefficients_.data(), a.coefficients_.size(), b.coefficients_.data(),
+                      b.coefficients_.size(), out.data());
+    return Polynomial(std::move(out));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::ntt_multiply(const Polynomial& a, const Polynomial& b) {
+    if (a.is_zero() || b.is_zero()) {
+        return Polynomial();
+    }
+    return Polynomial(ntt_product(a.coefficients_, b.coefficients_));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::operator+(const Polynomial& rhs) const {
+    std::vector<FF> c(std::max(coefficients_.size(), rhs.coefficients_.size()), FF::zero());
+    for (size_t i = 0; i < coefficients_.size(); i++) {
+        c[i] = coefficients_[i];
+    }
+    for (size_t i = 0; i < rhs.coefficients_.size(); i++) {
+        c[i] += rhs.coefficients_[i];
+    }
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::operator-(const Polynomial& rhs) const {
+    return *this + (-rhs);
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::operator*(const Polynomial& rhs) const {
+    return Polynomial(product(coefficients_, rhs.coefficients_));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::operator*(const FF& scalar) const {
+    std::vector<FF> c(coefficients_);
+    for (auto& coefficient : c) {
+        coefficient *= scalar;
+    }
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+Polynomial<FF> Polynomial<FF>::operator-() const {
+    std::vector<FF> c(coefficients_);
+    for (auto& coefficient : c) {
+        coefficient = -coefficient;
+    }
+    return Polynomial(std::move(c));
+}
+
+template <typename FF>
+std::string Polynomial<FF>::to_string() const {
+    if (is_zero()) {
+        return "0";
+    }
+    std::ostringstream oss;
+    bool first = true;
+    for (size_t k = coefficients_.size(); k > 0; k--) {
+        const FF& c = coefficients_[k - 1];
+        if (c.is_zero()) {
+            continue;
+        }
+        if (!first) {
+            oss << " + ";
+        }
+        first = false;
+        oss << c.to_string();
+        if (k - 1 == 1) {
+            oss << "·x";
+        } else if (k - 1 > 1) {
+            oss << "·x^" << (k - 1);
+        }
+    }
+    return oss.str();
+}
+
+template class Polynomial<BFieldElement>;
+
+} // namespace tip5xx
@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/scratch_arena.hpp"
+
+#include <limits>
+#include <new>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+namespace tip5xx {
+
+ScratchArena::ScratchArena(size_t max_cached_bytes)
+    : cached_bytes_(0), max_cached_bytes_(max_cached_bytes) {}
+
+ScratchArena::~ScratchArena() {
+    trim();
+}
+
+ScratchArena& ScratchArena::global() {
+    static ScratchArena arena;
+    return arena;
+}
+
+size_t ScratchArena::size_class(size_t n, size_t elem_size) {
+    constexpr size_t MAX_CLASS = (std::numeric_limits<size_t>::max() >> 1) + 1;
+    if (n > MAX_CLASS / elem_size) {
+        throw std::bad_array_new_length();
+    }
+    size_t bytes = ALIGNMENT;
+    while (bytes < n * elem_size) {
+        bytes <<= 1;
+    }
+    return bytes;
+}
+
+void* ScratchArena::allocate(size_t bytes) {
+#if !defined(_WIN32)
+    if (bytes >= HUGE_PAGE_SIZE) {
+        void* data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (data == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined(MADV_HUGEPAGE)
+        // Advisory only; the mapping works with regular pages if this fails
+        madvise(data, bytes, MADV_HUGEPAGE);
+#endif
+        return data;
+    }
+#endif
+    return ::operator new(bytes, std::align_val_t(ALIGNMENT));
+}
+
+void ScratchArena::deallocate(void* data, size_t bytes) noexcept {
+#if !defined(_WIN32)
+    if (bytes >= HUGE_PAGE_SIZE) {
+        munmap(data, bytes);
+        return;
+    }
+#endif
+    ::operator delete(data, std::align_val_t(ALIGNMENT));
+}
+
+void* ScratchArena::take(size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = free_.size(); i-- > 0;) {
+            if (free_[i].bytes == bytes) {
+                void* data = free_[i].data;
+                free_[i] = free_.back();
+                free_.pop_back();
+                cached_bytes_ -= bytes;
+                return data;
+            }
+        }
+    }
+    return allocate(bytes);
+}
+
+void ScratchArena::give_back(void* data, size_t bytes) noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cached_bytes_ + bytes <= max_cached_bytes_) {
+            try {
+                free_.push_back(Block{data, bytes});
+                cached_bytes_ += bytes;
+                return;
+            } catch (const std::bad_alloc&) {
+                // Fall through and release the buffer instead of pooling it
+            }
+        }
+    }
+    deallocate(data, bytes);
+}
+
+size_t ScratchArena::cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+}
+
+void ScratchArena::trim() {
+    std::vector<Block> blocks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks.swap(free_);
+        cached_bytes_ = 0;
+    }
+    for (const Block& block : blocks) {
+        deallocate(block.data, block.bytes);
+    }
+}
+
+} // namespace tip5xx
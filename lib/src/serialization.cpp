@@ -0,0 +1,203 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/serialization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "tip5xx/b_field_element_simd.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+static_assert(sizeof(BFieldElement) == sizeof(uint64_t), "BFieldElement must be a single machine word");
+static_assert(std::is_standard_layout_v<BFieldElement>, "BFieldElement must be standard layout");
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool HOST_IS_LITTLE_ENDIAN = false;
+#else
+constexpr bool HOST_IS_LITTLE_ENDIAN = true;
+#endif
+
+// Elements converted per kernel call; the constant operand lives on the stack
+constexpr size_t BLOCK = 256;
+
+// montyred(x · 1) leaves Montgomery form, montyred(x · R²) enters it
+struct ConversionFactors {
+    std::array<uint64_t, BLOCK> from_montgomery;
+    std::array<uint64_t, BLOCK> to_montgomery;
+};
+
+const ConversionFactors& conversion_factors() {
+    static const ConversionFactors factors = [] {
+        ConversionFactors f;
+        f.from_montgomery.fill(1);
+        f.to_montgomery.fill(BFieldElement::R2);
+        return f;
+    }();
+    return factors;
+}
+
+const uint64_t* raw(span<const BFieldElement> values) {
+    return reinterpret_cast<const uint64_t*>(values.data());
+}
+
+uint64_t* raw(span<BFieldElement> values) {
+    return reinterpret_cast<uint64_t*>(values.data());
+}
+
+// Little-endian words of `count` elements between memory and host order
+void load_words(const void* src, uint64_t* dst, size_t count) {
+    std::memcpy(dst, src, count * sizeof(uint64_t));
+    if constexpr (!HOST_IS_LITTLE_ENDIAN) {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = __builtin_bswap64(dst[i]);
+        }
+    }
+}
+
+void store_words(const uint64_t* src, void* dst, size_t count) {
+    if constexpr (HOST_IS_LITTLE_ENDIAN) {
+        std::memcpy(dst, src, count * sizeof(uint64_t));
+    } else {
+        auto* bytes = static_cast<uint8_t*>(dst);
+        for (size_t i = 0; i < count; i++) {
+            uint64_t word = __builtin_bswap64(src[i]);
+            std::memcpy(bytes + i * sizeof(uint64_t), &word, sizeof(word));
+        }
+    }
+}
+
+// u16 limbs, least significant first, differ from the word's memory order on big-endian hosts
+void load_limbs(const uint16_t* src, uint64_t* dst, size_t count) {
+    if constexpr (HOST_IS_LITTLE_ENDIAN) {
+        std::memcpy(dst, src, count * sizeof(uint64_t));
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            const uint16_t* limbs = src + 4 * i;
+            dst[i] = uint64_t{limbs[0]} | uint64_t{limbs[1]} << 16 | uint64_t{limbs[2]} << 32 |
+                     uint64_t{limbs[3]} << 48;
+        }
+    }
+}
+
+void store_limbs(const uint64_t* src, uint16_t* dst, size_t count) {
+    if constexpr (HOST_IS_LITTLE_ENDIAN) {
+        std::memcpy(dst, src, count * sizeof(uint64_t));
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                dst[4 * i + j] = static_cast<uint16_t>(src[i] >> (16 * j));
+            }
+        }
+    }
+}
+
+// Index of the first word that is not below P, or npos; the common all-valid
+// case is a branch-free pass the compiler vectorizes
+size_t first_non_canonical(const uint64_t* words, size_t count) {
+    uint64_t invalid = 0;
+    for (size_t i = 0; i < count; i++) {
+        invalid |= static_cast<uint64_t>(words[i] >= BFieldElement::P);
+    }
+    if (invalid == 0) {
+        return DecodeStatus::npos;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (words[i] >= BFieldElement::P) {
+            return i;
+        }
+    }
+    return DecodeStatus::npos;
+}
+
+void check_lengths(size_t values, size_t units, size_t per_value, const char* what) {
+    if (units != values * per_value) {
+        throw std::invalid_argument(std::string(what) + ": buffer length does not match the number of elements");
+    }
+}
+
+template <typename Store>
+void encode(span<const BFieldElement> values, Store store) {
+    const ConversionFactors& factors = conversion_factors();
+    std::array<uint64_t, BLOCK> canonical;
+    for (size_t begin = 0; begin < values.size(); begin += BLOCK) {
+        size_t count = std::min(BLOCK, values.size() - begin);
+        BFieldElementSimd::mul_raw(raw(values) + begin, factors.from_montgomery.data(), canonical.data(), count);
+        store(canonical.data(), begin, count);
+    }
+}
+
+template <typename Load>
+DecodeStatus decode(span<BFieldElement> out, Load load) {
+    const ConversionFactors& factors = conversion_factors();
+    std::array<uint64_t, BLOCK> canonical;
+    for (size_t begin = 0; begin < out.size(); begin += BLOCK) {
+        size_t count = std::min(BLOCK, out.size() - begin);
+        load(canonical.data(), begin, count);
+
+        size_t bad = first_non_canonical(canonical.data(), count);
+        size_t valid = bad == DecodeStatus::npos ? count : bad;
+        BFieldElementSimd::mul_raw(canonical.data(), factors.to_montgomery.data(), raw(out) + begin, valid);
+        if (bad != DecodeStatus::npos) {
+            return DecodeStatus{begin + bad};
+        }
+    }
+    return DecodeStatus{};
+}
+
+} // namespace
+
+void encode_bytes(span<const BFieldElement> values, span<uint8_t> out) {
+    check_lengths(values.size(), out.size(), BFieldElement::BYTES, "encode_bytes");
+    encode(values, [&](const uint64_t* words, size_t begin, size_t count) {
+        store_words(words, out.data() + begin * BFieldElement::BYTES, count);
+    });
+}
+
+DecodeStatus decode_bytes(span<const uint8_t> bytes, span<BFieldElement> out) {
+    check_lengths(out.size(), bytes.size(), BFieldElement::BYTES, "decode_bytes");
+    return decode(out, [&](uint64_t* words, size_t begin, size_t count) {
+        load_words(bytes.data() + begin * BFieldElement::BYTES, words, count);
+    });
+}
+
+void encode_u16s(span<const BFieldElement> values, span<uint16_t> out) {
+    check_lengths(values.size(), out.size(), 4, "encode_u16s");
+    encode(values, [&](const uint64_t* words, size_t begin, size_t count) {
+        store_limbs(words, out.data() + 4 * begin, count);
+    });
+}
+
+DecodeStatus decode_u16s(span<const uint16_t> chunks, span<BFieldElement> out) {
+    check_lengths(out.size(), chunks.size(), 4, "decode_u16s");
+    return decode(out, [&](uint64_t* words, size_t begin, size_t count) {
+        load_limbs(chunks.data() + 4 * begin, words, count);
+    });
+}
+
+} // namespace tip5xx
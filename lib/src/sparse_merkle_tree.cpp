@@ -0,0 +1,279 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/sparse_merkle_tree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/scratch_arena.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Levels with fewer pending nodes are hashed on the calling thread
+constexpr size_t MIN_NODES_PER_THREAD = 1024;
+
+std::shared_ptr<const std::vector<Digest>> make_defaults(const Digest& default_leaf) {
+    auto defaults = std::make_shared<std::vector<Digest>>(SparseMerkleTree::MAX_HEIGHT + 1);
+    (*defaults)[0] = default_leaf;
+    for (size_t level = 1; level <= SparseMerkleTree::MAX_HEIGHT; level++) {
+        (*defaults)[level] = Tip5Sponge::hash_pair((*defaults)[level - 1], (*defaults)[level - 1]);
+    }
+    return defaults;
+}
+
+// Default digests of the all-zero leaf, shared by every tree using it
+const std::shared_ptr<const std::vector<Digest>>& zero_leaf_defaults() {
+    static const std::shared_ptr<const std::vector<Digest>> defaults = make_defaults(Digest());
+    return defaults;
+}
+
+} // namespace
+
+// Append-only node storage. Block k holds 2^(FIRST_BLOCK_LOG2 + k) nodes and
+// is allocated once, so growing never moves a node other copies may be
+// reading; index 0 is NIL, the default subtree.
+class SparseMerkleTree::Arena {
+public:
+    Arena() { push_back(Node{Digest(), NIL, NIL}); }
+
+    Node& operator[](NodeIndex index) { return locate(index); }
+    const Node& operator[](NodeIndex index) const { return locate(index); }
+
+    size_t size() const { return size_; }
+
+    NodeIndex push_back(const Node& node) {
+        if (size_ > std::numeric_limits<NodeIndex>::max()) {
+            throw std::length_error("SparseMerkleTree: node arena exhausted, compact() the tree");
+        }
+        uint64_t slot = size_ + FIRST_BLOCK_SIZE;
+        size_t block = static_cast<size_t>(63 - __builtin_clzll(slot)) - FIRST_BLOCK_LOG2;
+        if (!blocks_[block]) {
+            blocks_[block].reset(new Node[FIRST_BLOCK_SIZE << block]);
+        }
+        blocks_[block][slot - (FIRST_BLOCK_SIZE << block)] = node;
+        return static_cast<NodeIndex>(size_++);
+    }
+
+private:
+    static constexpr size_t FIRST_BLOCK_LOG2 = 6;
+    static constexpr uint64_t FIRST_BLOCK_SIZE = uint64_t{1} << FIRST_BLOCK_LOG2;
+    // Enough blocks to address every NodeIndex
+    static constexpr size_t NUM_BLOCKS = 8 * sizeof(NodeIndex) + 1 - FIRST_BLOCK_LOG2;
+
+    Node& locate(NodeIndex index) const {
+        uint64_t slot = uint64_t{index} + FIRST_BLOCK_SIZE;
+        size_t block = static_cast<size_t>(63 - __builtin_clzll(slot)) - FIRST_BLOCK_LOG2;
+        return blocks_[block][slot - (FIRST_BLOCK_SIZE << block)];
+    }
+
+    std::array<std::unique_ptr<Node[]>, NUM_BLOCKS> blocks_;
+    size_t size_ = 0;
+};
+
+SparseMerkleTree::SparseMerkleTree(size_t height, const Digest& default_leaf)
+    : height_(height), arena_(std::make_shared<Arena>()), root_(NIL), live_nodes_(0) {
+    if (height > MAX_HEIGHT) {
+        throw std::invalid_argument("SparseMerkleTree: height must not exceed " + std::to_string(MAX_HEIGHT) +
+                                    ", got " + std::to_string(height));
+    }
+    defaults_ = default_leaf == Digest() ? zero_leaf_defaults() : make_defaults(default_leaf);
+}
+
+const Digest& SparseMerkleTree::digest_at(NodeIndex index, size_t level) const {
+    return index == NIL ? (*defaults_)[level] : (*arena_)[index].digest;
+}
+
+SparseMerkleTree::NodeIndex SparseMerkleTree::allocate(const Digest& digest, NodeIndex left, NodeIndex right) {
+    return arena_->push_back(Node{digest, left, right});
+}
+
+void SparseMerkleTree::check_key(Key key) const {
+    if (height_ < MAX_HEIGHT && (key >> height_) != 0) {
+        throw std::out_of_range("SparseMerkleTree: key " + std::to_string(key) + " out of range for height " +
+                                std::to_string(height_));
+    }
+}
+
+Digest SparseMerkleTree::get(Key key) const {
+    check_key(key);
+    NodeIndex index = root_;
+    for (size_t level = height_; level > 0 && index != NIL; level--) {
+        const Node& node = (*arena_)[index];
+        index = (key >> (level - 1)) & 1 ? node.right : node.left;
+    }
+    return digest_at(index, 0);
+}
+
+void SparseMerkleTree::set(Key key, const Digest& leaf) {
+    Write write(key, leaf);
+    update(span<const Write>(&write, 1), 1);
+}
+
+// New node for the subtree `old` at `level` after applying writes [begin, end),
+// which are sorted, free of duplicates and all inside the subtree. Inner nodes
+// are queued in pending[level] and hashed once the level below is done. Every
+// old node visited is replaced and counted in `replaced`.
+SparseMerkleTree::NodeIndex SparseMerkleTree::rebuild(NodeIndex old, size_t level, const Write* begin,
+                                                      const Write* end,
+                                                      std::vector<std::vector<NodeIndex>>& pending,
+                                                      size_t& replaced) {
+    if (old != NIL) {
+        replaced++;
+    }
+    if (level == 0) {
+        const Digest& leaf = begin->second;
+        return leaf == (*defaults_)[0] ? NIL : allocate(leaf, NIL, NIL);
+    }
+
+    Key bit = Key{1} << (level - 1);
+    const Write* mid = std::partition_point(begin, end, [bit](const Write& w) { return (w.first & bit) == 0; });
+
+    NodeIndex left = old == NIL ? NIL : (*arena_)[old].left;
+    NodeIndex right = old == NIL ? NIL : (*arena_)[old].right;
+    if (begin != mid) {
+        left = rebuild(left, level - 1, begin, mid, pending, replaced);
+    }
+    if (mid != end) {
+        right = rebuild(right, level - 1, mid, end, pending, replaced);
+    }
+    if (left == NIL && right == NIL) {
+        return NIL;
+    }
+
+    NodeIndex index = allocate(Digest(), left, right);
+    pending[level].push_back(index);
+    return index;
+}
+
+void SparseMerkleTree::update(span<const Write> writes, size_t num_threads) {
+    if (writes.empty()) {
+        return;
+    }
+    for (const Write& write : writes) {
+        check_key(write.first);
+    }
+
+    // Sort by key keeping the last write of each
+    std::vector<Write> sorted(writes.begin(), writes.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const Write& a, const Write& b) { return a.first < b.first; });
+    auto last = std::unique(sorted.rbegin(), sorted.rend(),
+                            [](const Write& a, const Write& b) { return a.first == b.first; });
+    sorted.erase(sorted.begin(), last.base());
+
+    std::vector<std::vector<NodeIndex>> pending(height_ + 1);
+    size_t allocated_before = arena_->size();
+    size_t replaced = 0;
+    NodeIndex root = rebuild(root_, height_, sorted.data(), sorted.data() + sorted.size(), pending, replaced);
+    size_t live_nodes = live_nodes_ + (arena_->size() - allocated_before) - replaced;
+
+    size_t widest = 0;
+    for (const std::vector<NodeIndex>& nodes : pending) {
+        widest = std::max(widest, nodes.size());
+    }
+    auto lefts = ScratchArena::global().borrow<Digest>(widest);
+    auto rights = ScratchArena::global().borrow<Digest>(widest);
+    auto parents = ScratchArena::global().borrow<Digest>(widest);
+    for (size_t level = 1; level <= height_; level++) {
+        const std::vector<NodeIndex>& nodes = pending[level];
+        for (size_t i = 0; i < nodes.size(); i++) {
+            const Node& node = (*arena_)[nodes[i]];
+            lefts[i] = digest_at(node.left, level - 1);
+            rights[i] = digest_at(node.right, level - 1);
+        }
+
+        parallel_for(nodes.size(), MIN_NODES_PER_THREAD, [&](size_t begin, size_t end) {
+            Tip5Sponge::hash_pairs(span<const Digest>(lefts.data() + begin, end - begin),
+                                   span<const Digest>(rights.data() + begin, end - begin),
+                                   span<Digest>(parents.data() + begin, end - begin));
+        }, num_threads);
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            (*arena_)[nodes[i]].digest = parents[i];
+        }
+    }
+    root_ = root;
+    live_nodes_ = live_nodes;
+
+    // Nodes are only reclaimed by copying, so do it once they are mostly garbage.
+    // While copies share the arena they keep the garbage alive, and copying
+    // would only duplicate the live nodes and break sharing with them.
+    if (arena_.use_count() == 1 && arena_size() >= AUTO_COMPACT_MIN_NODES &&
+        arena_size() > 2 * live_nodes_) {
+        compact();
+    }
+}
+
+std::vector<Digest> SparseMerkleTree::authentication_path(Key key) const {
+    check_key(key);
+    std::vector<Digest> path(height_);
+    NodeIndex index = root_;
+    for (size_t level = height_; level > 0; level--) {
+        NodeIndex left = index == NIL ? NIL : (*arena_)[index].left;
+        NodeIndex right = index == NIL ? NIL : (*arena_)[index].right;
+        bool is_right = (key >> (level - 1)) & 1;
+        path[level - 1] = digest_at(is_right ? left : right, level - 1);
+        index = is_right ? right : left;
+    }
+    return path;
+}
+
+bool SparseMerkleTree::verify(const Digest& root, size_t height, Key key, const Digest& leaf,
+                              span<const Digest> path) {
+    if (height > MAX_HEIGHT || path.size() != height || (height < MAX_HEIGHT && (key >> height) != 0)) {
+        return false;
+    }
+    Digest node = leaf;
+    for (size_t level = 0; level < height; level++) {
+        node = (key >> level) & 1 ? Tip5Sponge::hash_pair(path[level], node)
+                                  : Tip5Sponge::hash_pair(node, path[level]);
+    }
+    return node == root;
+}
+
+size_t SparseMerkleTree::arena_size() const {
+    return arena_->size() - 1;
+}
+
+SparseMerkleTree::NodeIndex SparseMerkleTree::copy_into(Arena& arena, NodeIndex index) const {
+    if (index == NIL) {
+        return NIL;
+    }
+    const Node& node = (*arena_)[index];
+    Node copy{node.digest, copy_into(arena, node.left), copy_into(arena, node.right)};
+    return arena.push_back(copy);
+}
+
+void SparseMerkleTree::compact() {
+    auto arena = std::make_shared<Arena>();
+    root_ = copy_into(*arena, root_);
+    arena_ = std::move(arena);
+}
+
+} // namespace tip5xx
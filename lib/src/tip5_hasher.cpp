@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/tip5_hasher.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace tip5xx {
+
+namespace {
+
+// Byte that terminates the byte input
+constexpr uint8_t BYTE_TERMINATOR = 0x01;
+
+} // namespace
+
+Tip5Hasher::Tip5Hasher(Input input) : input_(input), sponge_(Domain::VariableLength) {
+    reset();
+}
+
+void Tip5Hasher::reset() {
+    sponge_ = Tip5Sponge::init();
+    if (input_ == Input::Bytes) {
+        sponge_.state()[Tip5Sponge::STATE_SIZE - 1] = BFieldElement::ONE;
+    }
+    buffer_.fill(BFieldElement::ZERO);
+    buffered_ = 0;
+    limb_ = 0;
+    limb_bytes_ = 0;
+    absorbed_elements_ = 0;
+}
+
+void Tip5Hasher::push(BFieldElement element) {
+    buffer_[buffered_++] = element;
+    absorbed_elements_++;
+    if (buffered_ == Tip5Sponge::RATE) {
+        sponge_.absorb(buffer_);
+        buffered_ = 0;
+    }
+}
+
+void Tip5Hasher::update(const uint8_t* data, size_t length) {
+    if (input_ != Input::Bytes) {
+        throw std::logic_error("Tip5Hasher: byte input to an element hasher");
+    }
+
+    size_t offset = 0;
+
+    // Complete a partial limb left over from the previous call
+    while (limb_bytes_ != 0 && offset < length) {
+        limb_ |= static_cast<uint64_t>(data[offset++]) << (8 * limb_bytes_);
+        if (++limb_bytes_ == BYTES_PER_ELEMENT) {
+            push(BFieldElement::new_element(limb_));
+            limb_ = 0;
+            limb_bytes_ = 0;
+        }
+    }
+
+    // Whole limbs straight from the input
+    for (; offset + BYTES_PER_ELEMENT <= length; offset += BYTES_PER_ELEMENT) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < BYTES_PER_ELEMENT; i++) {
+            value |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+        }
+        push(BFieldElement::new_element(value));
+    }
+
+    // Keep the tail for the next call
+    for (; offset < length; offset++) {
+        limb_ |= static_cast<uint64_t>(data[offset]) << (8 * limb_bytes_++);
+    }
+}
+
+void Tip5Hasher::update(span<const BFieldElement> elements) {
+    if (input_ != Input::Elements) {
+        throw std::logic_error("Tip5Hasher: element input to a byte hasher");
+    }
+    for (const BFieldElement& element : elements) {
+        push(element);
+    }
+}
+
+Digest Tip5Hasher::finalize() {
+    if (input_ == Input::Bytes) {
+        // A partial limb has at most 6 bytes, so the terminator always fits
+        limb_ |= static_cast<uint64_t>(BYTE_TERMINATOR) << (8 * limb_bytes_);
+        push(BFieldElement::new_element(limb_));
+    }
+
+    // Pad with [1, 0, 0, …] exactly as Tip5Sponge::pad_and_absorb_all
+    std::fill(buffer_.begin() + buffered_, buffer_.end(), BFieldElement::ZERO);
+    buffer_[buffered_] = BFieldElement::ONE;
+    sponge_.absorb(buffer_);
+    Tip5Sponge::RateBlock produce = sponge_.squeeze();
+
+    Digest::Values values;
+    std::copy(produce.begin(), produce.begin() + Digest::LEN, values.begin());
+
+    reset();
+    return Digest(values);
+}
+
+Digest Tip5Hasher::hash_bytes(const uint8_t* data, size_t length) {
+    Tip5Hasher hasher(Input::Bytes);
+    hasher.update(data, length);
+    return hasher.finalize();
+}
+
+} // namespace tip5xx
@@ -0,0 +1,323 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/tip5_sponge.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include "tip5xx/instrumentation.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+// Raw (Montgomery form) field arithmetic, mirrors BFieldElement operators
+inline uint64_t add_raw(uint64_t a, uint64_t b) {
+    uint64_t x1;
+    bool c1 = __builtin_sub_overflow(a, BFieldElement::P - b, &x1);
+    return c1 ? x1 + BFieldElement::P : x1;
+}
+
+inline uint64_t mul_raw(uint64_t a, uint64_t b) {
+    return BFieldElement::montyred(static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b));
+}
+
+// Structure-of-arrays state of several independent sponges: element i of
+// every lane is stored contiguously so each step of a round is a loop over lanes
+constexpr size_t LANES = Tip5Sponge::BATCH_LANES;
+using LaneRow = std::array<uint64_t, LANES>;
+using LaneState = std::array<LaneRow, Tip5Sponge::STATE_SIZE>;
+
+void lanes_sbox_layer(LaneState& state) {
+    for (size_t i = 0; i < Tip5Sponge::NUM_SPLIT_AND_LOOKUP; i++) {
+        for (size_t lane = 0; lane < LANES; lane++) {
+            BFieldElement e = BFieldElement::from_raw_u64(state[i][lane]);
+            Tip5Sponge::split_and_lookup(e);
+            state[i][lane] = e.raw_u64();
+        }
+    }
+
+    for (size_t i = Tip5Sponge::NUM_SPLIT_AND_LOOKUP; i < Tip5Sponge::STATE_SIZE; i++) {
+        LaneRow& row = state[i];
+        for (size_t lane = 0; lane < LANES; lane++) {
+            row[lane] = BFieldElement::from_raw_u64(row[lane]).pow<7>().raw_u64();
+        }
+    }
+}
+
+void lanes_mds(LaneState& state) {
+    // Same split into 32-bit halves as Tip5Sponge::mds
+    LaneState lo;
+    LaneState hi;
+    for (size_t i = 0; i < Tip5Sponge::STATE_SIZE; i++) {
+        for (size_t lane = 0; lane < LANES; lane++) {
+            lo[i][lane] = state[i][lane] & 0xFFFFFFFFULL;
+            hi[i][lane] = state[i][lane] >> 32;
+        }
+    }
+
+    for (size_t r = 0; r < Tip5Sponge::STATE_SIZE; r++) {
+        LaneRow lo_sum{};
+        LaneRow hi_sum{};
+        for (size_t j = 0; j < Tip5Sponge::STATE_SIZE; j++) {
+            uint64_t entry = Tip5Sponge::MDS_MATRIX_FIRST_COLUMN[(r + Tip5Sponge::STATE_SIZE - j) % Tip5Sponge::STATE_SIZE];
+            for (size_t lane = 0; lane < LANES; lane++) {
+                lo_sum[lane] += entry * lo[j][lane];
+                hi_sum[lane] += entry * hi[j][lane];
+            }
+        }
+
+        for (size_t lane = 0; lane < LANES; lane++) {
+            __uint128_t sum = static_cast<__uint128_t>(lo_sum[lane]) + (static_cast<__uint128_t>(hi_sum[lane]) << 32);
+            state[r][lane] = BFieldElement::mod_reduce(sum);
+        }
+    }
+}
+
+void lanes_permutation(LaneState& state) {
+    for (size_t round = 0; round < Tip5Sponge::NUM_ROUNDS; round++) {
+        lanes_sbox_layer(state);
+        lanes_mds(state);
+        for (size_t i = 0; i < Tip5Sponge::STATE_SIZE; i++) {
+            uint64_t constant = Tip5Sponge::ROUND_CONSTANTS[round * Tip5Sponge::STATE_SIZE + i].raw_u64();
+            for (size_t lane = 0; lane < LANES; lane++) {
+                state[i][lane] = add_raw(state[i][lane], constant);
+            }
+        }
+    }
+}
+
+} // namespace
+
+static_assert(Tip5Sponge::LOOKUP_TABLE[0] == 0 && Tip5Sponge::LOOKUP_TABLE[1] == 7 && Tip5Sponge::LOOKUP_TABLE[255] == 255,
+              "Lookup table generation is incorrect");
+static_assert(Tip5Sponge::ROUND_CONSTANTS[0].value() == detail::TIP5_ROUND_CONSTANT_VALUES[0],
+              "Round constants must round-trip through Montgomery form");
+static_assert(Tip5Sponge::STATE_SIZE * sizeof(BFieldElement) == 2 * 64,
+              "A round's constants must fill two cache lines");
+
+Tip5Sponge::Tip5Sponge(Domain domain) : state_{} {
+    if (domain == Domain::FixedLength) {
+        for (size_t i = RATE; i < STATE_SIZE; i++) {
+            state_[i] = BFieldElement::ONE;
+        }
+    }
+}
+
+void Tip5Sponge::split_and_lookup(BFieldElement& element) {
+    // The lookup is applied to the bytes of the Montgomery representation
+    uint64_t raw = element.raw_u64();
+    uint64_t result = 0;
+
+    for (size_t i = 0; i < 8; i++) {
+        uint64_t byte = (raw >> (8 * i)) & 0xFF;
+        result |= static_cast<uint64_t>(LOOKUP_TABLE[byte]) << (8 * i);
+    }
+
+    element = BFieldElement::from_raw_u64(result);
+}
+
+void Tip5Sponge::sbox_layer() {
+    for (size_t i = 0; i < NUM_SPLIT_AND_LOOKUP; i++) {
+        split_and_lookup(state_[i]);
+    }
+
+    // Power map x ↦ x^7 for the remaining elements
+    for (size_t i = NUM_SPLIT_AND_LOOKUP; i < STATE_SIZE; i++) {
+        state_[i] = state_[i].pow<7>();
+    }
+}
+
+void Tip5Sponge::mds() {
+    // The matrix is linear, so it can be applied directly to the Montgomery
+    // representation. Every entry is below 2^16, so after splitting each value
+    // into 32-bit halves a full row accumulates without overflowing 64 bits.
+    std::array<uint64_t, STATE_SIZE> lo;
+    std::array<uint64_t, STATE_SIZE> hi;
+    for (size_t i = 0; i < STATE_SIZE; i++) {
+        uint64_t raw = state_[i].raw_u64();
+        lo[i] = raw & 0xFFFFFFFFULL;
+        hi[i] = raw >> 32;
+    }
+
+    for (size_t r = 0; r < STATE_SIZE; r++) {
+        uint64_t lo_sum = 0;
+        uint64_t hi_sum = 0;
+        for (size_t j = 0; j < STATE_SIZE; j++) {
+            uint64_t entry = MDS_MATRIX_FIRST_COLUMN[(r + STATE_SIZE - j) % STATE_SIZE];
+            lo_sum += entry * lo[j];
+            hi_sum += entry * hi[j];
+        }
+
+        __uint128_t sum = static_cast<__uint128_t>(lo_sum) + (static_cast<__uint128_t>(hi_sum) << 32);
+        state_[r] = BFieldElement::from_raw_u64(BFieldElement::mod_reduce(sum));
+    }
+}
+
+void Tip5Sponge::round(size_t round_index) {
+    sbox_layer();
+    mds();
+    for (size_t i = 0; i < STATE_SIZE; i++) {
+        state_[i] += ROUND_CONSTANTS[round_index * STATE_SIZE + i];
+    }
+}
+
+void Tip5Sponge::permutation() {
+    TIP5XX_COUNT(permutations, 1);
+    for (size_t i = 0; i < NUM_ROUNDS; i++) {
+        round(i);
+    }
+}
+
+void Tip5Sponge::absorb(const RateBlock& input) {
+    TIP5XX_COUNT(absorbed_blocks, 1);
+    std::copy(input.begin(), input.end(), state_.begin());
+    permutation();
+}
+
+Tip5Sponge::RateBlock Tip5Sponge::squeeze() {
+    TIP5XX_COUNT(squeezes, 1);
+    RateBlock produce;
+    std::copy(state_.begin(), state_.begin() + RATE, produce.begin());
+    permutation();
+    return produce;
+}
+
+void Tip5Sponge::pad_and_absorb_all(const std::vector<BFieldElement>& input) {
+    pad_and_absorb_all(input.data(), input.size());
+}
+
+void Tip5Sponge::pad_and_absorb_all(const BFieldElement* input, size_t length) {
+    RateBlock chunk;
+    size_t offset = 0;
+    for (; offset + RATE <= length; offset += RATE) {
+        std::copy(input + offset, input + offset + RATE, chunk.begin());
+        absorb(chunk);
+    }
+
+    // Pad input with [1, 0, 0, …] – padding is at least one element
+    size_t remainder = length - offset;
+    chunk.fill(BFieldElement::ZERO);
+    std::copy(input + offset, input + length, chunk.begin());
+    chunk[remainder] = BFieldElement::ONE;
+    absorb(chunk);
+}
+
+Digest Tip5Sponge::hash_pair(const Digest& left, const Digest& right) {
+    Tip5Sponge sponge(Domain::FixedLength);
+    std::copy(left.values().begin(), left.values().end(), sponge.state_.begin());
+    std::copy(right.values().begin(), right.values().end(), sponge.state_.begin() + Digest::LEN);
+    TIP5XX_COUNT(absorbed_blocks, 1);
+    sponge.permutation();
+
+    Digest::Values values;
+    std::copy(sponge.state_.begin(), sponge.state_.begin() + Digest::LEN, values.begin());
+    return Digest(values);
+}
+
+namespace {
+
+// Shared driver of hash_pairs and hash_layer; left(i) and right(i) return the
+// inputs of pair i
+template <typename Left, typename Right>
+void hash_pairs_in_lanes(size_t count, Left left, Right right, Digest* out) {
+    const uint64_t one = BFieldElement::ONE.raw_u64();
+    for (size_t base = 0; base < count; base += LANES) {
+        size_t lanes = std::min(LANES, count - base);
+
+        // Fixed-length domain; unused lanes are permuted but never read back
+        LaneState state{};
+        for (size_t lane = 0; lane < lanes; lane++) {
+            const Digest& l = left(base + lane);
+            const Digest& r = right(base + lane);
+            for (size_t i = 0; i < Digest::LEN; i++) {
+                state[i][lane] = l[i].raw_u64();
+                state[Digest::LEN + i][lane] = r[i].raw_u64();
+            }
+        }
+        for (size_t i = Tip5Sponge::RATE; i < Tip5Sponge::STATE_SIZE; i++) {
+            state[i].fill(one);
+        }
+
+        lanes_permutation(state);
+        TIP5XX_COUNT(permutations, lanes);
+        TIP5XX_COUNT(absorbed_blocks, lanes);
+
+        for (size_t lane = 0; lane < lanes; lane++) {
+            Digest& digest = out[base + lane];
+            for (size_t i = 0; i < Digest::LEN; i++) {
+                digest[i] = BFieldElement::from_raw_u64(state[i][lane]);
+            }
+        }
+    }
+}
+
+} // namespace
+
+void Tip5Sponge::hash_pairs(span<const Digest> lefts, span<const Digest> rights, span<Digest> out) {
+    if (lefts.size() != rights.size() || lefts.size() != out.size()) {
+        throw std::invalid_argument("hash_pairs: lefts, rights and out must have the same length");
+    }
+    TIP5XX_TRACE_SCOPE("tip5xx::Tip5Sponge::hash_pairs");
+
+    hash_pairs_in_lanes(
+        out.size(),
+        [&](size_t i) -> const Digest& { return lefts[i]; },
+        [&](size_t i) -> const Digest& { return rights[i]; },
+        out.data());
+}
+
+void Tip5Sponge::hash_layer(span<const Digest> children, span<Digest> parents) {
+    if (children.size() != 2 * parents.size()) {
+        throw std::invalid_argument("hash_layer: children must hold exactly two digests per parent");
+    }
+    TIP5XX_TRACE_SCOPE("tip5xx::Tip5Sponge::hash_layer");
+
+    hash_pairs_in_lanes(
+        parents.size(),
+        [&](size_t i) -> const Digest& { return children[2 * i]; },
+        [&](size_t i) -> const Digest& { return children[2 * i + 1]; },
+        parents.data());
+}
+
+Digest Tip5Sponge::hash_10(const RateBlock& input) {
+    Tip5Sponge sponge(Domain::FixedLength);
+    std::copy(input.begin(), input.end(), sponge.state_.begin());
+    TIP5XX_COUNT(absorbed_blocks, 1);
+    sponge.permutation();
+
+    Digest::Values values;
+    std::copy(sponge.state_.begin(), sponge.state_.begin() + Digest::LEN, values.begin());
+    return Digest(values);
+}
+
+Digest Tip5Sponge::hash_varlen(const std::vector<BFieldElement>& input) {
+    Tip5Sponge sponge = init();
+    sponge.pad_and_absorb_all(input);
+    RateBlock produce = sponge.squeeze();
+
+    Digest::Values values;
+    std::copy(produce.begin(), produce.begin() + Digest::LEN, values.begin());
+    return Digest(values);
+}
+
+} // namespace tip5xx
@@ -26,81 +26,94 @@
 
 #include "tip5xx/tip5xx.hpp"
 
+#include "tip5xx/instrumentation.hpp"
+
 namespace tip5xx {
 
+namespace {
+
+// Capacity tag separating hash_varlen_sponge from the zero-initialized hash_pair
+constexpr uint8_t VARLEN_DOMAIN = 0x01;
+
+} // namespace
+
 void Tip5::xor_bytes(uint8_t* dest, const uint8_t* src, size_t len) {
     for (size_t i = 0; i < len; ++i) {
         dest[i] ^= src[i];
     }
 }
 
-uint8_t Tip5::rotl8(uint8_t x, unsigned int n) {
-    return (x << n) | (x >> (8 - n));
+void Tip5::permute(State& state) {
+    Sponge::permute(state);
 }
 
 void Tip5::permute(uint8_t* state) {
-    for (size_t round = 0; round < ROUNDS; ++round) {
-        // Add round constant to first byte
-        state[0] ^= ROUND_CONSTANTS[round];
-
-        // Non-linear layer: Apply S-box to each byte
-        for (size_t i = 0; i < STATE_SIZE; ++i) {
-            // S-box function: x ← (x + (x ≪ 2)) ⊕ (x ≫ 1)
-            uint8_t x = state[i];
-            x = x + rotl8(x, 2);
-            x = x ^ (x >> 1);
-            state[i] = x;
-        }
+    Sponge::Permutation::permute(state);
+}
 
-        // Linear mixing layer
-        // Mix each byte with its neighbors using rotations and XORs
-        std::vector<uint8_t> temp(STATE_SIZE);
-        for (size_t i = 0; i < STATE_SIZE; ++i) {
-            uint8_t prev = state[(i + STATE_SIZE - 1) % STATE_SIZE];
-            uint8_t curr = state[i];
-            uint8_t next = state[(i + 1) % STATE_SIZE];
+std::vector<uint8_t> Tip5::hash_pair(const std::vector<uint8_t>& left, const std::vector<uint8_t>& right) {
+    Hash hash;
+    hash_pair(left, right, hash);
+    return std::vector<uint8_t>(hash.begin(), hash.end());
+}
 
-            temp[i] = curr ^ rotl8(prev, 1) ^ rotl8(next, 2);
-        }
-        std::memcpy(state, temp.data(), STATE_SIZE);
-    }
+void Tip5::hash_pair(span<const uint8_t> left, span<const uint8_t> right, Hash& out) {
+    hash_pair(left.data(), left.size(), right.data(), right.size(), out);
+}
+
+void Tip5::hash_pair(const uint8_t* left, size_t left_len, const uint8_t* right, size_t right_len, Hash& out) {
+    Sponge::hash_pair(left, left_len, right, right_len, out);
+}
+
+size_t Tip5::varlen_begin(State& state) {
+    state.fill(0);
+    state[STATE_SIZE - 1] = VARLEN_DOMAIN;
+    return 0;
 }
 
-void Tip5::absorb(uint8_t* state, const uint8_t* data, size_t len) {
+size_t Tip5::absorb_bytes(State& state, size_t position, const uint8_t* data, size_t len) {
     size_t absorbed = 0;
     while (absorbed < len) {
-        size_t to_absorb = std::min(RATE, len - absorbed);
-        xor_bytes(state, data + absorbed, to_absorb);
-        permute(state);
+        size_t to_absorb = std::min(RATE - position, len - absorbed);
+        xor_bytes(state.data() + position, data + absorbed, to_absorb);
         absorbed += to_absorb;
+        position += to_absorb;
+        if (position == RATE) {
+            TIP5XX_COUNT(absorbed_blocks, 1);
+            permute(state);
+            position = 0;
+        }
     }
+    return position;
 }
 
-void Tip5::squeeze(uint8_t* state, uint8_t* output, size_t len) {
-    size_t squeezed = 0;
-    while (squeezed < len) {
-        size_t to_squeeze = std::min(RATE, len - squeezed);
-        std::memcpy(output + squeezed, state, to_squeeze);
-        permute(state);
-        squeezed += to_squeeze;
+size_t Tip5::varlen_absorb_length(State& state, size_t position, uint64_t len) {
+    uint8_t prefix[8];
+    for (size_t i = 0; i < 8; i++) {
+        prefix[i] = static_cast<uint8_t>(len >> (8 * i));
     }
+    return absorb_bytes(state, position, prefix, sizeof(prefix));
 }
 
-std::vector<uint8_t> Tip5::hash_pair(const std::vector<uint8_t>& left, const std::vector<uint8_t>& right) {
-    // Initialize state to zero
-    std::vector<uint8_t> state(STATE_SIZE, 0);
-
-    // Absorb left input
-    absorb(state.data(), left.data(), left.size());
+size_t Tip5::varlen_absorb(State& state, size_t position, const uint8_t* data, size_t len) {
+    position = varlen_absorb_length(state, position, static_cast<uint64_t>(len));
+    return absorb_bytes(state, position, data, len);
+}
 
-    // Absorb right input
-    absorb(state.data(), right.data(), right.size());
+Tip5::Hash Tip5::varlen_finish(State& state, size_t position) {
+    // pad10*1 within the rate
+    state[position] ^= 0x01;
+    state[RATE - 1] ^= 0x80;
+    TIP5XX_COUNT(absorbed_blocks, 1);
+    permute(state);
 
-    // Squeeze out the hash
-    std::vector<uint8_t> result(HASH_SIZE);
-    squeeze(state.data(), result.data(), HASH_SIZE);
+    Hash hash;
+    Sponge::squeeze(state, hash.data(), HASH_SIZE);
+    return hash;
+}
 
-    return result;
+Tip5::Hash Tip5::hash_varlen_sponge(span<const span<const uint8_t>> inputs) {
+    return hash_varlen_sponge(inputs.begin(), inputs.end());
 }
 
 std::vector<uint8_t> Tip5::hash_varlen(const std::vector<std::vector<uint8_t>>& inputs) {
@@ -110,14 +123,28 @@ std::vector<uint8_t> Tip5::hash_varlen(const std::vector<std::vector<uint8_t>>&
     }
 
     // Start with first element
-    std::vector<uint8_t> result = hash_pair(inputs[0], inputs[0]);
+    Hash result;
+    hash_pair(inputs[0], inputs[0], result);
 
     // Hash each subsequent element with the running result
     for (size_t i = 1; i < inputs.size(); i++) {
-        result = hash_pair(result, inputs[i]);
+        hash_pair(result, inputs[i], result);
     }
 
-    return result;
+    return std::vector<uint8_t>(result.begin(), result.end());
+}
+
+void Tip5::hash_varlen(span<const span<const uint8_t>> inputs, Hash& out) {
+    if (inputs.empty()) {
+        // Zero hash for empty input
+        out.fill(0);
+        return;
+    }
+
+    hash_pair(inputs[0], inputs[0], out);
+    for (size_t i = 1; i < inputs.size(); i++) {
+        hash_pair(out, inputs[i], out);
+    }
 }
 
 } // namespace tip5xx
@@ -0,0 +1,300 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include "tip5xx/x_field_element.hpp"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include "tip5xx/b_field_element_simd.hpp"
+
+namespace tip5xx {
+
+namespace {
+
+static_assert(sizeof(XFieldElement) == XFieldElement::EXTENSION_DEGREE * sizeof(BFieldElement),
+              "XFieldElement must be tightly packed");
+
+// Scalars expanded per block of mul_by_bfe
+constexpr size_t SCALE_BLOCK = 256;
+
+// Raw (Montgomery form) field arithmetic, mirrors BFieldElement operators
+inline uint64_t add_raw(uint64_t a, uint64_t b) {
+    uint64_t x1;
+    bool c1 = __builtin_sub_overflow(a, BFieldElement::P - b, &x1);
+    return c1 ? x1 + BFieldElement::P : x1;
+}
+
+inline uint64_t sub_raw(uint64_t a, uint64_t b) {
+    uint64_t x1;
+    bool c1 = __builtin_sub_overflow(a, b, &x1);
+    return c1 ? x1 + BFieldElement::P : x1;
+}
+
+inline uint64_t mul_raw(uint64_t a, uint64_t b) {
+    return BFieldElement::montyred(static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b));
+}
+
+inline BFieldElement from_raw(uint64_t x) {
+    return BFieldElement::from_raw_u64(x);
+}
+
+// Scale all coefficients by a base field element given in raw form
+inline XFieldElement scale_raw(const XFieldElement& x, uint64_t s) {
+    return XFieldElement(XFieldElement::Coefficients{
+        from_raw(mul_raw(x[0].raw_u64(), s)),
+        from_raw(mul_raw(x[1].raw_u64(), s)),
+        from_raw(mul_raw(x[2].raw_u64(), s)),
+    });
+}
+
+} // namespace
+
+XFieldElement XFieldElement::from_coefficients(span<const BFieldElement> coefficients) {
+    if (coefficients.size() != EXTENSION_DEGREE) {
+        throw std::invalid_argument("XFieldElement needs exactly " + std::to_string(EXTENSION_DEGREE) +
+                                    " coefficients, got " + std::to_string(coefficients.size()));
+    }
+    return XFieldElement(Coefficients{coefficients[0], coefficients[1], coefficients[2]});
+}
+
+std::optional<BFieldElement> XFieldElement::unlift() const {
+    if (coefficients_[1].is_zero() && coefficients_[2].is_zero()) {
+        return coefficients_[0];
+    }
+    return std::nullopt;
+}
+
+bool XFieldElement::is_zero() const {
+    return coefficients_[0].is_zero() && coefficients_[1].is_zero() && coefficients_[2].is_zero();
+}
+
+bool XFieldElement::is_one() const {
+    return coefficients_[0].is_one() && coefficients_[1].is_zero() && coefficients_[2].is_zero();
+}
+
+// Implementation of Inverse trait
+// Solves a · y = 1 with the multiplication-by-a matrix M, whose columns are
+// a, a·X and a·X² reduced by X³ = X - 1: y is the first column of adj(M) / det(M),
+// which costs a single base field inversion
+XFieldElement XFieldElement::inverse_impl() const {
+    if (is_zero()) {
+        throw BFieldElementInverseError();
+    }
+    uint64_t a0 = coefficients_[0].raw_u64();
+    uint64_t a1 = coefficients_[1].raw_u64();
+    uint64_t a2 = coefficients_[2].raw_u64();
+
+    // M = [[a0, -a2, -a1], [a1, a0 + a2, a1 - a2], [a2, a1, a0 + a2]]
+    uint64_t m11 = add_raw(a0, a2);
+    uint64_t m12 = sub_raw(a1, a2);
+
+    uint64_t c00 = sub_raw(mul_raw(m11, m11), mul_raw(m12, a1));
+    uint64_t c01 = sub_raw(mul_raw(m12, a2), mul_raw(a1, m11));
+    uint64_t c02 = sub_raw(mul_raw(a1, a1), mul_raw(m11, a2));
+
+    // det = a0·c00 - a2·c01 - a1·c02
+    uint64_t det = sub_raw(sub_raw(mul_raw(a0, c00), mul_raw(a2, c01)), mul_raw(a1, c02));
+    uint64_t det_inverse = from_raw(det).inverse().raw_u64();
+
+    return XFieldElement(Coefficients{
+        from_raw(mul_raw(c00, det_inverse)),
+        from_raw(mul_raw(c01, det_inverse)),
+        from_raw(mul_raw(c02, det_inverse)),
+    });
+}
+
+XFieldElement XFieldElement::primitive_root_of_unity_impl(uint64_t n) {
+    return new_const(BFieldElement::primitive_root_of_unity(n));
+}
+
+XFieldElement XFieldElement::mod_pow_u64_impl(uint64_t exp) const {
+    return mod_pow(exp);
+}
+
+XFieldElement XFieldElement::mod_pow_u32_impl(uint32_t exp) const {
+    return mod_pow(static_cast<uint64_t>(exp));
+}
+
+std::vector<XFieldElement> XFieldElement::cyclic_group_elements_impl(size_t max) const {
+    // Special case for zero
+    if (is_zero()) {
+        return {ZERO};
+    }
+
+    // Power-of-two subgroups (every NTT domain) are preallocated and filled in parallel
+    size_t order = power_of_two_order();
+    if (order != 0) {
+        std::vector<XFieldElement> result(max == 0 ? order : std::min(order, max));
+        powers_into(result);
+        return result;
+    }
+
+    XFieldElement val = *this;
+    std::vector<XFieldElement> result = {ONE};
+
+    while (!val.is_one() && (max == 0 || result.size() < max)) {
+        result.push_back(val);
+        val *= *this;
+    }
+
+    return result;
+}
+
+XFieldElement XFieldElement::mod_pow(uint64_t exp) const {
+    XFieldElement acc = ONE;
+    if (exp == 0) {
+        return acc;
+    }
+    for (int i = 63 - __builtin_clzll(exp); i >= 0; i--) {
+        acc = acc * acc;
+        if ((exp >> i) & 1) {
+            acc = acc * (*this);
+        }
+    }
+    return acc;
+}
+
+XFieldElement XFieldElement::operator+(const XFieldElement& rhs) const {
+    return XFieldElement(Coefficients{
+        from_raw(add_raw(coefficients_[0].raw_u64(), rhs[0].raw_u64())),
+        from_raw(add_raw(coefficients_[1].raw_u64(), rhs[1].raw_u64())),
+        from_raw(add_raw(coefficients_[2].raw_u64(), rhs[2].raw_u64())),
+    });
+}
+
+XFieldElement& XFieldElement::operator+=(const XFieldElement& rhs) {
+    *this = *this + rhs;
+    return *this;
+}
+
+XFieldElement XFieldElement::operator-(const XFieldElement& rhs) const {
+    return XFieldElement(Coefficients{
+        from_raw(sub_raw(coefficients_[0].raw_u64(), rhs[0].raw_u64())),
+        from_raw(sub_raw(coefficients_[1].raw_u64(), rhs[1].raw_u64())),
+        from_raw(sub_raw(coefficients_[2].raw_u64(), rhs[2].raw_u64())),
+    });
+}
+
+XFieldElement& XFieldElement::operator-=(const XFieldElement& rhs) {
+    *this = *this - rhs;
+    return *this;
+}
+
+// Karatsuba product of two quadratics followed by reduction with
+// X³ = X - 1 and X⁴ = X² - X
+XFieldElement XFieldElement::operator*(const XFieldElement& rhs) const {
+    uint64_t a0 = coefficients_[0].raw_u64();
+    uint64_t a1 = coefficients_[1].raw_u64();
+    uint64_t a2 = coefficients_[2].raw_u64();
+    uint64_t b0 = rhs[0].raw_u64();
+    uint64_t b1 = rhs[1].raw_u64();
+    uint64_t b2 = rhs[2].raw_u64();
+
+    uint64_t m0 = mul_raw(a0, b0);
+    uint64_t m1 = mul_raw(a1, b1);
+    uint64_t m2 = mul_raw(a2, b2);
+
+    // Coefficients of X, X² and X³ of the unreduced product; X⁴ has m2
+    uint64_t d1 = sub_raw(sub_raw(mul_raw(add_raw(a0, a1), add_raw(b0, b1)), m0), m1);
+    uint64_t d2 = add_raw(sub_raw(sub_raw(mul_raw(add_raw(a0, a2), add_raw(b0, b2)), m0), m2), m1);
+    uint64_t d3 = sub_raw(sub_raw(mul_raw(add_raw(a1, a2), add_raw(b1, b2)), m1), m2);
+
+    return XFieldElement(Coefficients{
+        from_raw(sub_raw(m0, d3)),
+        from_raw(sub_raw(add_raw(d1, d3), m2)),
+        from_raw(add_raw(d2, m2)),
+    });
+}
+
+XFieldElement& XFieldElement::operator*=(const XFieldElement& rhs) {
+    *this = *this * rhs;
+    return *this;
+}
+
+XFieldElement XFieldElement::operator/(const XFieldElement& rhs) const {
+    return *this * rhs.inverse_impl();
+}
+
+XFieldElement XFieldElement::operator-() const {
+    return ZERO - *this;
+}
+
+XFieldElement XFieldElement::operator+(const BFieldElement& rhs) const {
+    return XFieldElement(Coefficients{coefficients_[0] + rhs, coefficients_[1], coefficients_[2]});
+}
+
+XFieldElement XFieldElement::operator-(const BFieldElement& rhs) const {
+    return XFieldElement(Coefficients{coefficients_[0] - rhs, coefficients_[1], coefficients_[2]});
+}
+
+XFieldElement XFieldElement::operator*(const BFieldElement& rhs) const {
+    return scale_raw(*this, rhs.raw_u64());
+}
+
+XFieldElement& XFieldElement::operator*=(const BFieldElement& rhs) {
+    *this = *this * rhs;
+    return *this;
+}
+
+void XFieldElement::mul_by_bfe(span<const BFieldElement> scalars, span<const XFieldElement> values,
+                               span<XFieldElement> out) {
+    if (scalars.size() != values.size() || values.size() != out.size()) {
+        throw std::invalid_argument("XFieldElement::mul_by_bfe: span sizes differ");
+    }
+
+    // XFieldElement is three packed words, so each block is one packed multiply
+    // of its coefficients by the scalars repeated three times
+    constexpr size_t D = EXTENSION_DEGREE;
+    const uint64_t* coefficients = reinterpret_cast<const uint64_t*>(values.data());
+    uint64_t* products = reinterpret_cast<uint64_t*>(out.data());
+    std::array<uint64_t, D * SCALE_BLOCK> repeated;
+    for (size_t begin = 0; begin < values.size(); begin += SCALE_BLOCK) {
+        size_t count = std::min(SCALE_BLOCK, values.size() - begin);
+        for (size_t i = 0; i < count; i++) {
+            uint64_t s = scalars[begin + i].raw_u64();
+            repeated[D * i] = s;
+            repeated[D * i + 1] = s;
+            repeated[D * i + 2] = s;
+        }
+        BFieldElementSimd::mul_raw(coefficients + D * begin, repeated.data(), products + D * begin, D * count);
+    }
+}
+
+// Same format as twenty-first: base field elements print with an _xfe suffix
+std::string XFieldElement::to_string() const {
+    if (std::optional<BFieldElement> base = unlift()) {
+        return base->to_string() + "_xfe";
+    }
+    std::ostringstream oss;
+    oss << "(" << coefficients_[2].to_string() << "·x² + " << coefficients_[1].to_string() << "·x + "
+        << coefficients_[0].to_string() << ")";
+    return oss.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const XFieldElement& xfe) {
+    return os << xfe.to_string();
+}
+
+} // namespace tip5xx
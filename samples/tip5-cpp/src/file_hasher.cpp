@@ -0,0 +1,245 @@
+/**
+ *
+ * Copyright (c) 2025 Maxim [maxirmx] Samsonov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is a part of tip5xx library
+ *
+ */
+
+#include "file_hasher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/parallel.hpp"
+#include "tip5xx/tip5_hasher.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TIP5XX_SAMPLE_HAS_MMAP 1
+#endif
+
+namespace {
+
+// Size of the buffer for reads when a file is not mapped
+constexpr size_t READ_BUFFER_SIZE = size_t{4} << 20;
+
+#if defined(TIP5XX_SAMPLE_HAS_MMAP)
+// Read-only private mapping of a whole regular file
+class MappedFile {
+public:
+    // Returns false if the file cannot be mapped (not regular, empty, or mmap fails)
+    bool open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            return false;
+        }
+        ::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+        data_ = static_cast<const uint8_t*>(data);
+        size_ = static_cast<size_t>(st.st_size);
+        return true;
+    }
+
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+    }
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+#endif
+
+// Calls fn on consecutive blocks of the stream; every block but the last has block_size bytes
+void read_blocks(std::FILE* file, size_t block_size, const std::function<void(const uint8_t*, size_t)>& fn) {
+    std::vector<uint8_t> buffer(block_size);
+    while (true) {
+        size_t filled = 0;
+        while (filled < block_size) {
+            size_t n = std::fread(buffer.data() + filled, 1, block_size - filled, file);
+            if (n == 0) {
+                break;
+            }
+            filled += n;
+        }
+        if (std::ferror(file)) {
+            throw std::runtime_error(std::strerror(errno));
+        }
+        if (filled > 0) {
+            fn(buffer.data(), filled);
+        }
+        if (filled < block_size) {
+            return;
+        }
+    }
+}
+
+// Permutations of a byte hasher finalized after absorbing `elements` packed
+// limbs: the full rate blocks including the terminator limb, the padded last
+// block and the squeeze
+uint64_t byte_hash_permutations(uint64_t elements) {
+    return (elements + 1) / tip5xx::Tip5Sponge::RATE + 2;
+}
+
+uint64_t hash_bytes_permutations(uint64_t length) {
+    return byte_hash_permutations(length / tip5xx::Tip5Hasher::BYTES_PER_ELEMENT);
+}
+
+// Power-of-two leaf count padded with default digests, then the root; each
+// inner node is one hash_pair permutation
+tip5xx::Digest merkle_root(std::vector<tip5xx::Digest> leaves, size_t threads, uint64_t& permutations) {
+    if (leaves.empty()) {
+        leaves.push_back(tip5xx::Tip5Hasher::hash_bytes(nullptr, 0));
+        permutations += hash_bytes_permutations(0);
+    }
+    size_t padded = 1;
+    while (padded < leaves.size()) {
+        padded <<= 1;
+    }
+    permutations += padded - 1;
+    leaves.resize(padded);
+    return tip5xx::MerkleTree(leaves, threads).root();
+}
+
+// Hash a memory region in one pass or as Merkle leaves hashed in parallel
+void hash_region(const uint8_t* data, size_t size, const FileHashOptions& options, size_t threads,
+                 FileHashResult& result) {
+    result.bytes = size;
+    if (!options.merkle) {
+        result.digest = tip5xx::Tip5Hasher::hash_bytes(data, size);
+        result.permutations = hash_bytes_permutations(size);
+        return;
+    }
+
+    size_t num_chunks = (size + options.chunk_size - 1) / options.chunk_size;
+    std::vector<tip5xx::Digest> leaves(num_chunks);
+    tip5xx::parallel_for(num_chunks, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            size_t offset = i * options.chunk_size;
+            leaves[i] = tip5xx::Tip5Hasher::hash_bytes(data + offset, std::min(options.chunk_size, size - offset));
+        }
+    }, threads);
+    for (size_t i = 0; i < num_chunks; i++) {
+        result.permutations += hash_bytes_permutations(std::min(options.chunk_size, size - i * options.chunk_size));
+    }
+    result.digest = merkle_root(std::move(leaves), threads, result.permutations);
+}
+
+// Hash a stream with bounded memory: a single hasher, or one leaf per chunk
+void hash_stream(std::FILE* file, const FileHashOptions& options, size_t threads, FileHashResult& result) {
+    if (!options.merkle) {
+        tip5xx::Tip5Hasher hasher(tip5xx::Tip5Hasher::Input::Bytes);
+        read_blocks(file, READ_BUFFER_SIZE, [&](const uint8_t* data, size_t n) {
+            hasher.update(data, n);
+            result.bytes += n;
+        });
+        result.permutations = byte_hash_permutations(hasher.absorbed_elements());
+        result.digest = hasher.finalize();
+        return;
+    }
+
+    std::vector<tip5xx::Digest> leaves;
+    read_blocks(file, options.chunk_size, [&](const uint8_t* data, size_t n) {
+        leaves.push_back(tip5xx::Tip5Hasher::hash_bytes(data, n));
+        result.permutations += hash_bytes_permutations(n);
+        result.bytes += n;
+    });
+    result.digest = merkle_root(std::move(leaves), threads, result.permutations);
+}
+
+FileHashResult hash_file(const std::string& path, const FileHashOptions& options, size_t threads) {
+    FileHashResult result;
+    result.path = path;
+
+    try {
+        if (path == "-") {
+            hash_stream(stdin, options, threads, result);
+            return result;
+        }
+
+#if defined(TIP5XX_SAMPLE_HAS_MMAP)
+        if (options.use_mmap) {
+            MappedFile mapped;
+            if (mapped.open(path)) {
+                hash_region(mapped.data(), mapped.size(), options, threads, result);
+                return result;
+            }
+        }
+#endif
+
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+        if (!file) {
+            result.error = std::strerror(errno);
+            return result;
+        }
+        hash_stream(file.get(), options, threads, result);
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    return result;
+}
+
+} // namespace
+
+std::vector<FileHashResult> hash_files(const std::vector<std::string>& paths, const FileHashOptions& options) {
+    if (options.chunk_size == 0) {
+        throw std::invalid_argument("chunk size must be positive");
+    }
+    size_t jobs = options.jobs == 0 ? tip5xx::default_thread_count() : options.jobs;
+    std::vector<FileHashResult> results(paths.size());
+
+    // A single file gets all threads for its Merkle leaves; several files get one thread each
+    if (paths.size() == 1) {
+        results[0] = hash_file(paths[0], options, jobs);
+        return results;
+    }
+
+    tip5xx::parallel_for(paths.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            results[i] = hash_file(paths[i], options, 1);
+        }
+    }, jobs);
+    return results;
+}
@@ -0,0 +1,53 @@
+/**
+ *
+ * Copyright (c) 2025 Maxim [maxirmx] Samsonov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is a part of tip5xx library
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "tip5xx/digest.hpp"
+
+// Settings of the file hashing mode
+struct FileHashOptions {
+    size_t jobs = 1;                     // Worker threads; 0 uses all hardware threads
+    bool merkle = false;                 // Merkle root over fixed-size chunks instead of one digest
+    size_t chunk_size = size_t{1} << 20; // Merkle leaf size in bytes
+    bool use_mmap = true;                // Map regular files instead of reading them
+};
+
+struct FileHashResult {
+    std::string path;
+    tip5xx::Digest digest;
+    uint64_t bytes = 0;        // Input size
+    uint64_t permutations = 0; // Tip5 permutations run, including Merkle nodes
+    std::string error;         // Non-empty if the file could not be hashed
+};
+
+// Hashes each path ("-" is stdin) with tip5xx::Tip5Hasher, files in parallel
+// when options.jobs > 1. Results keep the order of paths.
+std::vector<FileHashResult> hash_files(const std::vector<std::string>& paths, const FileHashOptions& options);
@@ -24,11 +24,13 @@
  *
  */
 
+#include <chrono>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 #include <string>
 #include "tip5xx/tip5xx.hpp"
+#include "file_hasher.hpp"
 #include <CLI/CLI.hpp>
 
 // Helper function to print hash result
@@ -95,17 +97,55 @@ std::vector<uint8_t> parse_number(const std::string& input) {
     return bytes;
 }
 
+// Hash files or stdin and report throughput on stderr, keeping stdout to one digest per line
+int run_file_mode(const std::vector<std::string>& paths, const FileHashOptions& options) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<FileHashResult> results = hash_files(paths, options);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t total_bytes = 0;
+    uint64_t total_permutations = 0;
+    int status = 0;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            std::cerr << "Error: " << result.path << ": " << result.error << std::endl;
+            status = 1;
+            continue;
+        }
+        std::cout << result.digest.to_string() << "  " << result.path << std::endl;
+        total_bytes += result.bytes;
+        total_permutations += result.permutations;
+    }
+
+    double safe_seconds = seconds > 0 ? seconds : 1e-9;
+    std::cerr << std::fixed << std::setprecision(3)
+              << "Hashed " << total_bytes << " bytes in " << results.size() << " input(s), "
+              << seconds << " s: " << std::setprecision(1)
+              << static_cast<double>(total_bytes) / 1e6 / safe_seconds << " MB/s, "
+              << static_cast<double>(total_permutations) / safe_seconds << " permutations/s" << std::endl;
+    return status;
+}
+
 int main(int argc, char** argv) {
     CLI::App app{"TIP5 Hash Calculator"};
 
     // Command line options
     std::string mode = "pair";
-    app.add_option("-m,--mode", mode, "Hash mode: 'pair' or 'varlen'")->check(CLI::IsMember({"pair", "varlen"}));
+    app.add_option("-m,--mode", mode, "Hash mode: 'pair', 'varlen' or 'file'")->check(CLI::IsMember({"pair", "varlen", "file"}));
+
+    FileHashOptions file_options;
+    bool no_mmap = false;
+    app.add_option("-j,--jobs", file_options.jobs, "File mode: worker threads, 0 for all hardware threads");
+    app.add_flag("--merkle", file_options.merkle, "File mode: print the Merkle root over fixed-size chunks");
+    app.add_option("--chunk-size", file_options.chunk_size, "File mode: Merkle chunk size in bytes")
+       ->check(CLI::PositiveNumber);
+    app.add_flag("--no-mmap", no_mmap, "File mode: read files instead of mapping them");
 
     std::vector<std::string> inputs;
     app.add_option("inputs", inputs, "Input numbers")->required()
        ->description("For pair mode: provide exactly 2 numbers\n"
                     "For varlen mode: provide 2 or more numbers\n"
+                    "For file mode: provide file paths, '-' for stdin\n"
                     "Supported formats:\n"
                     "- Hexadecimal: 0x01020304 (must use 0x prefix)\n"
                     "- Decimal: 16909060\n"
@@ -114,6 +154,11 @@ int main(int argc, char** argv) {
     CLI11_PARSE(app, argc, argv);
 
     try {
+        if (mode == "file") {
+            file_options.use_mmap = !no_mmap;
+            return run_file_mode(inputs, file_options);
+        }
+
         if (mode == "pair") {
             if (inputs.size() != 2) {
                 std::cerr << "Error: pair mode requires exactly 2 inputs" << std::endl;
@@ -0,0 +1,345 @@
+/**
+ *
+ * Copyright (c) 2025 Maxim [maxirmx] Samsonov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is a part of tip5xx library
+ *
+ */
+
+// Differential and throughput harness: feeds one random corpus through tip5xx
+// and through the twenty-first based samples/tip5-rust binary, checks that
+// every result agrees and prints the throughput of both side by side.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+#include <CLI/CLI.hpp>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace {
+
+struct Corpus {
+    std::vector<Digest> lefts;
+    std::vector<Digest> rights;
+    std::vector<std::vector<BFieldElement>> varlens;
+    std::vector<BFieldElement> mul_lhs;
+    std::vector<BFieldElement> mul_rhs;
+    std::vector<BFieldElement> invs;
+};
+
+// Operations per second of one side; a negative rate means "not measured"
+struct Throughput {
+    const char* kind;
+    const char* label;
+    double tip5xx = -1;
+    double rust = -1;
+};
+
+Corpus generate_corpus(uint64_t seed, size_t pairs, size_t varlens, size_t max_length, size_t field_ops) {
+    RandomGenerator rng(seed);
+    Corpus corpus;
+    for (size_t i = 0; i < pairs; ++i) {
+        corpus.lefts.push_back(rng.random_digest());
+        corpus.rights.push_back(rng.random_digest());
+    }
+    for (size_t i = 0; i < varlens; ++i) {
+        corpus.varlens.push_back(rng.random_elements(rng.random_range<size_t>(max_length)));
+    }
+    corpus.mul_lhs = rng.random_elements(field_ops);
+    corpus.mul_rhs = rng.random_elements(field_ops);
+    for (size_t i = 0; i < field_ops; ++i) {
+        BFieldElement value = rng.random_bfe();
+        corpus.invs.push_back(value.is_zero() ? BFieldElement::one() : value);
+    }
+    return corpus;
+}
+
+void append_values(std::ostream& out, const char* kind, const BFieldElement* values, size_t count) {
+    out << kind;
+    for (size_t i = 0; i < count; ++i) {
+        out << ' ' << values[i].value();
+    }
+    out << '\n';
+}
+
+// One line per entry: the kind followed by canonical decimal inputs
+void write_corpus(const Corpus& corpus, const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Cannot write corpus: " + path);
+    }
+    for (size_t i = 0; i < corpus.lefts.size(); ++i) {
+        std::array<BFieldElement, 2 * Digest::LEN> pair;
+        std::copy(corpus.lefts[i].values().begin(), corpus.lefts[i].values().end(), pair.begin());
+        std::copy(corpus.rights[i].values().begin(), corpus.rights[i].values().end(), pair.begin() + Digest::LEN);
+        append_values(out, "pair", pair.data(), pair.size());
+    }
+    for (const auto& input : corpus.varlens) {
+        append_values(out, "varlen", input.data(), input.size());
+    }
+    for (size_t i = 0; i < corpus.mul_lhs.size(); ++i) {
+        const BFieldElement operands[] = {corpus.mul_lhs[i], corpus.mul_rhs[i]};
+        append_values(out, "mul", operands, 2);
+    }
+    for (const auto& value : corpus.invs) {
+        append_values(out, "inv", &value, 1);
+    }
+    if (!out.flush()) {
+        throw std::runtime_error("Cannot write corpus: " + path);
+    }
+}
+
+// Expected result lines, in the format and order samples/tip5-rust prints them
+std::vector<std::string> expected_results(const Corpus& corpus) {
+    std::vector<std::string> lines;
+    std::ostringstream line;
+    auto push = [&](const char* kind, const BFieldElement* values, size_t count) {
+        line.str("");
+        append_values(line, kind, values, count);
+        std::string text = line.str();
+        text.pop_back();
+        lines.push_back(std::move(text));
+    };
+    for (size_t i = 0; i < corpus.lefts.size(); ++i) {
+        Digest digest = Tip5Sponge::hash_pair(corpus.lefts[i], corpus.rights[i]);
+        push("pair", digest.values().data(), Digest::LEN);
+    }
+    for (const auto& input : corpus.varlens) {
+        Digest digest = Tip5Sponge::hash_varlen(input);
+        push("varlen", digest.values().data(), Digest::LEN);
+    }
+    for (size_t i = 0; i < corpus.mul_lhs.size(); ++i) {
+        BFieldElement product = corpus.mul_lhs[i] * corpus.mul_rhs[i];
+        push("mul", &product, 1);
+    }
+    for (const auto& value : corpus.invs) {
+        BFieldElement inverse = value.inverse();
+        push("inv", &inverse, 1);
+    }
+    return lines;
+}
+
+// Time repeat passes of body over count entries; the sink keeps results alive
+template<typename Body>
+double ops_per_second(size_t count, unsigned repeat, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t sink = 0;
+    for (unsigned pass = 0; pass < repeat; ++pass) {
+        for (size_t i = 0; i < count; ++i) {
+            sink += body(i);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    volatile uint64_t keep = sink;
+    (void)keep;
+    return seconds > 0 ? static_cast<double>(count) * repeat / seconds : 0;
+}
+
+void measure_tip5xx(const Corpus& corpus, unsigned repeat, std::vector<Throughput>& rows) {
+    rows[0].tip5xx = ops_per_second(corpus.lefts.size(), repeat, [&](size_t i) {
+        return Tip5Sponge::hash_pair(corpus.lefts[i], corpus.rights[i])[0].value();
+    });
+    rows[1].tip5xx = ops_per_second(corpus.varlens.size(), repeat, [&](size_t i) {
+        return Tip5Sponge::hash_varlen(corpus.varlens[i])[0].value();
+    });
+    BFieldElement sum = BFieldElement::zero();
+    rows[2].tip5xx = ops_per_second(corpus.mul_lhs.size(), repeat, [&](size_t i) {
+        sum += corpus.mul_lhs[i] * corpus.mul_rhs[i];
+        return uint64_t{0};
+    });
+    rows[3].tip5xx = ops_per_second(corpus.invs.size(), repeat, [&](size_t i) {
+        sum += corpus.invs[i].inverse();
+        return uint64_t{0};
+    });
+    volatile uint64_t keep = sum.value();
+    (void)keep;
+
+    // hash_pairs has no counterpart in twenty-first, so the row is tip5xx only
+    std::vector<Digest> parents(corpus.lefts.size());
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned pass = 0; pass < repeat; ++pass) {
+        Tip5Sponge::hash_pairs(corpus.lefts, corpus.rights, parents);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    rows[4].tip5xx = seconds > 0 ? static_cast<double>(parents.size()) * repeat / seconds : 0;
+}
+
+// Run the Rust sample in corpus mode, compare its result lines against the
+// expected ones and collect its "time <kind> <count> <nanos>" lines.
+// Returns the number of mismatching results.
+size_t run_rust(const std::string& binary, const std::string& corpus_path, unsigned repeat,
+                const std::vector<std::string>& expected, std::vector<Throughput>& rows) {
+    std::string command = "\"" + binary + "\" -m corpus --repeat " + std::to_string(repeat) +
+                          " \"" + corpus_path + "\"";
+    FILE* pipe = popen(command.c_str(), "r");
+    if (pipe == nullptr) {
+        throw std::runtime_error("Cannot run: " + command);
+    }
+
+    size_t index = 0;
+    size_t mismatches = 0;
+    std::string line;
+    char buffer[4096];
+    while (std::fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        line += buffer;
+        if (line.empty() || line.back() != '\n') {
+            continue;
+        }
+        line.pop_back();
+        if (line.compare(0, 5, "time ") == 0) {
+            std::istringstream fields(line.substr(5));
+            std::string kind;
+            double count = 0;
+            double nanos = 0;
+            fields >> kind >> count >> nanos;
+            for (auto& row : rows) {
+                if (kind == row.kind && nanos > 0) {
+                    row.rust = count * 1e9 / nanos;
+                }
+            }
+        } else {
+            if (index >= expected.size() || line != expected[index]) {
+                if (mismatches < 10) {
+                    std::cerr << "Mismatch at corpus line " << index + 1 << ":\n"
+                              << "  tip5xx: " << (index < expected.size() ? expected[index] : "<none>") << "\n"
+                              << "  rust:   " << line << std::endl;
+                }
+                ++mismatches;
+            }
+            ++index;
+        }
+        line.clear();
+    }
+
+    int status = pclose(pipe);
+    if (status != 0) {
+        throw std::runtime_error("Rust sample failed: " + command);
+    }
+    if (index != expected.size()) {
+        std::cerr << "Rust sample returned " << index << " results, expected " << expected.size() << std::endl;
+        mismatches += index < expected.size() ? expected.size() - index : 0;
+    }
+    return mismatches;
+}
+
+std::string format_rate(double rate) {
+    if (rate < 0) {
+        return "-";
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(0) << rate;
+    return out.str();
+}
+
+void print_table(const std::vector<Throughput>& rows) {
+    std::cout << std::left << std::setw(24) << "operation"
+              << std::right << std::setw(16) << "tip5xx ops/s"
+              << std::setw(16) << "rust ops/s"
+              << std::setw(10) << "ratio" << std::endl;
+    for (const auto& row : rows) {
+        std::string ratio = "-";
+        if (row.tip5xx > 0 && row.rust > 0) {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(2) << row.tip5xx / row.rust << "x";
+            ratio = out.str();
+        }
+        std::cout << std::left << std::setw(24) << row.label
+                  << std::right << std::setw(16) << format_rate(row.tip5xx)
+                  << std::setw(16) << format_rate(row.rust)
+                  << std::setw(10) << ratio << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CLI::App app{"TIP5 differential and throughput harness"};
+
+    uint64_t seed = 0x7469703578780001ULL;
+    size_t pairs = 10000;
+    size_t varlens = 1000;
+    size_t max_length = 64;
+    size_t field_ops = 100000;
+    unsigned repeat = 10;
+    std::string rust;
+    std::string corpus_path = (std::filesystem::temp_directory_path() / "tip5xx_corpus.txt").string();
+
+    app.add_option("--seed", seed, "RandomGenerator seed of the corpus");
+    app.add_option("--pairs", pairs, "Number of hash_pair inputs");
+    app.add_option("--varlens", varlens, "Number of hash_varlen inputs");
+    app.add_option("--max-length", max_length, "Maximum hash_varlen input length in field elements");
+    app.add_option("--field-ops", field_ops, "Number of field multiplication and inversion inputs");
+    app.add_option("--repeat", repeat, "Timed passes over each corpus section")->check(CLI::PositiveNumber);
+    app.add_option("--rust", rust, "Path to the samples/tip5-rust binary; omit to run tip5xx only");
+    app.add_option("--corpus", corpus_path, "Where to write the corpus file");
+
+    CLI11_PARSE(app, argc, argv);
+
+    try {
+        Corpus corpus = generate_corpus(seed, pairs, varlens, max_length, field_ops);
+        write_corpus(corpus, corpus_path);
+        std::vector<std::string> expected = expected_results(corpus);
+        std::cout << "Corpus: " << expected.size() << " entries, seed " << seed << ", " << corpus_path << std::endl;
+
+        std::vector<Throughput> rows = {
+            {"pair", "hash_pair"},
+            {"varlen", "hash_varlen"},
+            {"mul", "field mul"},
+            {"inv", "field inverse"},
+            {"pairs", "hash_pairs (batched)"},
+        };
+        measure_tip5xx(corpus, repeat, rows);
+
+        size_t mismatches = 0;
+        if (!rust.empty()) {
+            mismatches = run_rust(rust, corpus_path, repeat, expected, rows);
+            if (mismatches == 0) {
+                std::cout << "All " << expected.size() << " results agree" << std::endl;
+            }
+        }
+        print_table(rows);
+
+        if (mismatches != 0) {
+            std::cerr << "Error: " << mismatches << " results differ" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -26,23 +26,30 @@
 
 use clap::{Parser, ValueEnum};
 use std::error::Error;
-use twenty_first::{math::tip5::Tip5, prelude::{Digest, BFieldElement}};
+use std::hint::black_box;
+use std::time::Instant;
+use twenty_first::{math::tip5::Tip5, math::traits::Inverse, prelude::{Digest, BFieldElement}};
 
 #[derive(Debug, Copy, Clone, PartialEq, Eq, ValueEnum)]
 enum Mode {
     Pair,
     Varlen,
+    Corpus,
 }
 
 #[derive(Parser)]
 #[command(author, version, about = "TIP5 Hash Calculator")]
 struct Args {
-    /// Hash mode: 'pair' or 'varlen'
+    /// Hash mode: 'pair', 'varlen' or 'corpus'
     #[arg(short, long, value_enum, default_value_t = Mode::Pair)]
     mode: Mode,
 
+    /// Corpus mode: number of timed passes over each section
+    #[arg(long, default_value_t = 1)]
+    repeat: u32,
+
     /// Input numbers (hex with 0x prefix, decimal, or octal with 0 prefix)
-    #[arg(required = true, help = "Input numbers.\nFor pair mode: provide exactly 2 numbers\nFor varlen mode: provide 2 or more numbers\nSupported formats:\n- Hexadecimal: 0x01020304 (must use 0x prefix)\n- Decimal: 16909060\n- Octal: 0100402404 (must use 0 prefix)")]
+    #[arg(required = true, help = "Input numbers.\nFor pair mode: provide exactly 2 numbers\nFor varlen mode: provide 2 or more numbers\nFor corpus mode: provide the corpus file written by tip5xx_differential\nSupported formats:\n- Hexadecimal: 0x01020304 (must use 0x prefix)\n- Decimal: 16909060\n- Octal: 0100402404 (must use 0 prefix)")]
     inputs: Vec<String>,
 }
 
@@ -69,6 +76,101 @@ fn print_hash(hash: &Digest) {
     println!("{:?}", hash);
 }
 
+fn digest_from(values: &[BFieldElement]) -> Digest {
+    Digest::new([values[0], values[1], values[2], values[3], values[4]])
+}
+
+fn print_values(kind: &str, values: &[BFieldElement]) {
+    print!("{}", kind);
+    for value in values {
+        print!(" {}", value.value());
+    }
+    println!();
+}
+
+fn print_time(kind: &str, count: usize, start: Instant) {
+    println!("time {} {} {}", kind, count, start.elapsed().as_nanos());
+}
+
+// Hash every entry of a tip5xx_differential corpus, one result line per entry in
+// corpus order, then time each section and print "time <kind> <count> <nanos>"
+fn run_corpus(path: &str, repeat: u32) -> Result<(), Box<dyn Error>> {
+    let text = std::fs::read_to_string(path)?;
+    let mut pairs = Vec::new();
+    let mut varlens = Vec::new();
+    let mut muls = Vec::new();
+    let mut invs = Vec::new();
+
+    for line in text.lines() {
+        let mut fields = line.split_whitespace();
+        let Some(kind) = fields.next() else { continue };
+        let mut values = Vec::new();
+        for field in fields {
+            values.push(BFieldElement::new(field.parse::<u64>()?));
+        }
+        match (kind, values.len()) {
+            ("pair", 10) => {
+                let pair = (digest_from(&values[0..5]), digest_from(&values[5..10]));
+                print_values("pair", &Tip5::hash_pair(pair.0, pair.1).values());
+                pairs.push(pair);
+            }
+            ("varlen", _) => {
+                print_values("varlen", &Tip5::hash_varlen(&values).values());
+                varlens.push(values);
+            }
+            ("mul", 2) => {
+                print_values("mul", &[values[0] * values[1]]);
+                muls.push((values[0], values[1]));
+            }
+            ("inv", 1) => {
+                print_values("inv", &[values[0].inverse()]);
+                invs.push(values[0]);
+            }
+            _ => return Err(format!("malformed corpus line: {}", line).into()),
+        }
+    }
+
+    let passes = repeat as usize;
+
+    let start = Instant::now();
+    for _ in 0..repeat {
+        for (left, right) in &pairs {
+            black_box(Tip5::hash_pair(black_box(*left), black_box(*right)));
+        }
+    }
+    print_time("pair", pairs.len() * passes, start);
+
+    let start = Instant::now();
+    for _ in 0..repeat {
+        for input in &varlens {
+            black_box(Tip5::hash_varlen(black_box(input)));
+        }
+    }
+    print_time("varlen", varlens.len() * passes, start);
+
+    let start = Instant::now();
+    let mut sum = BFieldElement::new(0);
+    for _ in 0..repeat {
+        for (a, b) in &muls {
+            sum += black_box(*a) * black_box(*b);
+        }
+    }
+    black_box(sum);
+    print_time("mul", muls.len() * passes, start);
+
+    let start = Instant::now();
+    let mut sum = BFieldElement::new(0);
+    for _ in 0..repeat {
+        for a in &invs {
+            sum += black_box(*a).inverse();
+        }
+    }
+    black_box(sum);
+    print_time("inv", invs.len() * passes, start);
+
+    Ok(())
+}
+
 fn main() -> Result<(), Box<dyn Error>> {
     let args = Args::parse();
 
@@ -112,6 +214,12 @@ fn main() -> Result<(), Box<dyn Error>> {
             print!("Result: ");
             print_hash(&result);
         }
+        Mode::Corpus => {
+            if args.inputs.len() != 1 {
+                return Err("corpus mode requires exactly 1 input".into());
+            }
+            run_corpus(&args.inputs[0], args.repeat)?;
+        }
     }
 
     Ok(())
@@ -25,6 +25,7 @@
 #include <random>
 #include <vector>
 #include "tip5xx/b_field_element.hpp"
+#include "tip5xx/digest.hpp"
 
 using namespace tip5xx;
 
@@ -87,4 +88,25 @@ public:
 
         return elements;
     }
+
+    // Generate a random Digest
+    Digest random_digest() {
+        Digest digest;
+        for (auto& value : digest.values()) {
+            value = random_bfe();
+        }
+        return digest;
+    }
+
+    // Generate multiple random Digests, e.g. Merkle tree leaves
+    std::vector<Digest> random_digests(size_t n) {
+        std::vector<Digest> digests;
+        digests.reserve(n);
+
+        for (size_t i = 0; i < n; i++) {
+            digests.push_back(random_digest());
+        }
+
+        return digests;
+    }
 };
@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/b_field_accumulator.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+BFieldElement naive_dot(const std::vector<BFieldElement>& a, const std::vector<BFieldElement>& b) {
+    BFieldElement sum = BFieldElement::ZERO;
+    for (size_t i = 0; i < a.size(); i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST(BFieldAccumulatorTest, MatchesReducedArithmetic) {
+    RandomGenerator rng(211);
+    BFieldAccumulator acc;
+    BFieldElement expected = BFieldElement::ZERO;
+    for (int i = 0; i < 100; i++) {
+        BFieldElement a = rng.random_bfe();
+        BFieldElement b = rng.random_bfe();
+        BFieldElement c = rng.random_bfe();
+        acc.mul_add(a, b);
+        acc.add(c);
+        expected += a * b + c;
+    }
+    EXPECT_EQ(acc.reduce(), expected);
+
+    acc.reset();
+    EXPECT_EQ(acc.reduce(), BFieldElement::ZERO);
+}
+
+TEST(BFieldAccumulatorTest, HandlesCarriesOutOf128Bits) {
+    // Largest Montgomery representation; every product is close to 2^128
+    BFieldElement big = BFieldElement::from_raw_u64(BFieldElement::P - 1);
+    std::vector<BFieldElement> a(5000, big);
+    std::vector<BFieldElement> b(5000, big);
+    EXPECT_EQ(dot_product(a, b), naive_dot(a, b));
+
+    BFieldAccumulator acc;
+    for (int i = 0; i < 5000; i++) {
+        acc.add(big);
+    }
+    EXPECT_EQ(acc.reduce(), big * BFieldElement::new_element(5000));
+}
+
+TEST(BFieldAccumulatorTest, DotProductAndAxpy) {
+    RandomGenerator rng(212);
+    for (size_t n : {0u, 1u, 7u, 1000u}) {
+        std::vector<BFieldElement> a = rng.random_elements(n);
+        std::vector<BFieldElement> b = rng.random_elements(n);
+        EXPECT_EQ(dot_product(a, b), naive_dot(a, b)) << "n = " << n;
+
+        BFieldElement alpha = rng.random_bfe();
+        std::vector<BFieldElement> y = b;
+        axpy(alpha, a, y);
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(y[i], b[i] + alpha * a[i]);
+        }
+    }
+
+    std::vector<BFieldElement> short_vector(3);
+    std::vector<BFieldElement> long_vector(4);
+    EXPECT_THROW(dot_product(short_vector, long_vector), std::invalid_argument);
+    EXPECT_THROW(axpy(BFieldElement::ONE, short_vector, long_vector), std::invalid_argument);
+}
+
+TEST(BFieldAccumulatorTest, LinearCombinationOverManyVectors) {
+    RandomGenerator rng(213);
+    const size_t n = 600;
+    std::vector<std::vector<BFieldElement>> columns;
+    std::vector<span<const BFieldElement>> views;
+    for (int k = 0; k < 9; k++) {
+        columns.push_back(rng.random_elements(n));
+    }
+    for (const auto& column : columns) {
+        views.emplace_back(column);
+    }
+    std::vector<BFieldElement> coefficients = rng.random_elements(columns.size());
+
+    std::vector<BFieldElement> out(n);
+    linear_combination(views, coefficients, out);
+    for (size_t i = 0; i < n; i++) {
+        BFieldElement expected = BFieldElement::ZERO;
+        for (size_t k = 0; k < columns.size(); k++) {
+            expected += coefficients[k] * columns[k][i];
+        }
+        ASSERT_EQ(out[i], expected) << "Failed at index " << i;
+    }
+
+    std::vector<BFieldElement> too_short(n - 1);
+    EXPECT_THROW(linear_combination(views, coefficients, too_short), std::invalid_argument);
+    EXPECT_THROW(linear_combination(views, span<const BFieldElement>(coefficients.data(), 2), out),
+                 std::invalid_argument);
+}
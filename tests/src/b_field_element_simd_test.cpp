@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "tip5xx/b_field_element_simd.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+const SimdKernel ALL_KERNELS[] = {SimdKernel::Scalar, SimdKernel::AVX2, SimdKernel::AVX512, SimdKernel::NEON};
+
+// Random elements with the extremes of the field mixed in
+std::vector<BFieldElement> test_elements(RandomGenerator& rng, size_t n) {
+    std::vector<BFieldElement> elements = rng.random_elements(n);
+    const BFieldElement edges[] = {bfe(0), bfe(1), bfe(BFieldElement::MAX), bfe(BFieldElement::MAX - 1),
+                                   bfe(0xFFFFFFFFULL), bfe(0x100000000ULL)};
+    for (size_t i = 0; i < n && i < 3 * std::size(edges); i += 3) {
+        elements[i] = edges[i / 3];
+    }
+    return elements;
+}
+
+} // namespace
+
+TEST(BFieldElementSimdTest, ScalarKernelIsAlwaysSupported) {
+    EXPECT_TRUE(BFieldElementSimd::is_supported(SimdKernel::Scalar));
+    EXPECT_TRUE(BFieldElementSimd::is_supported(BFieldElementSimd::active_kernel()));
+}
+
+TEST(BFieldElementSimdTest, KernelsMatchScalarOperators) {
+    RandomGenerator rng(5);
+    // Lengths that are not multiples of any vector width exercise the tails
+    for (size_t n : {0u, 1u, 3u, 8u, 37u, 1000u}) {
+        std::vector<BFieldElement> a = test_elements(rng, n);
+        std::vector<BFieldElement> b = test_elements(rng, n);
+        std::reverse(b.begin(), b.end());
+
+        for (SimdKernel kernel : ALL_KERNELS) {
+            if (!BFieldElementSimd::is_supported(kernel)) {
+                continue;
+            }
+            std::vector<BFieldElement> sum(n), diff(n), prod(n);
+            BFieldElementSimd::add(kernel, a, b, sum);
+            BFieldElementSimd::sub(kernel, a, b, diff);
+            BFieldElementSimd::mul(kernel, a, b, prod);
+
+            for (size_t i = 0; i < n; i++) {
+                EXPECT_EQ(sum[i], a[i] + b[i]) << BFieldElementSimd::kernel_name(kernel) << " add at " << i;
+                EXPECT_EQ(diff[i], a[i] - b[i]) << BFieldElementSimd::kernel_name(kernel) << " sub at " << i;
+                EXPECT_EQ(prod[i], a[i] * b[i]) << BFieldElementSimd::kernel_name(kernel) << " mul at " << i;
+                EXPECT_TRUE(BFieldElement::is_canonical(prod[i].raw_u64()));
+            }
+        }
+    }
+}
+
+TEST(BFieldElementSimdTest, MontyredKernelsMatchScalar) {
+    RandomGenerator rng(6);
+    std::vector<__uint128_t> x(101);
+    for (auto& v : x) {
+        // Products of two canonical values, the range montyred is used on
+        __uint128_t l = rng.random_range<uint64_t>(BFieldElement::MAX);
+        __uint128_t r = rng.random_range<uint64_t>(BFieldElement::MAX);
+        v = l * r;
+    }
+    x[0] = 0;
+    x[1] = static_cast<__uint128_t>(BFieldElement::MAX) * BFieldElement::MAX;
+
+    for (SimdKernel kernel : ALL_KERNELS) {
+        if (!BFieldElementSimd::is_supported(kernel)) {
+            continue;
+        }
+        std::vector<uint64_t> out(x.size());
+        BFieldElementSimd::montyred(kernel, x, out);
+        for (size_t i = 0; i < x.size(); i++) {
+            EXPECT_EQ(out[i], BFieldElement::montyred(x[i])) << BFieldElementSimd::kernel_name(kernel) << " at " << i;
+        }
+    }
+}
+
+TEST(BFieldElementSimdTest, OutputMayAliasInput) {
+    RandomGenerator rng(8);
+    std::vector<BFieldElement> a = rng.random_elements(19);
+    std::vector<BFieldElement> expected(a.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        expected[i] = a[i] * a[i];
+    }
+
+    BFieldElementSimd::mul(a, a, a);
+    EXPECT_EQ(a, expected);
+}
+
+TEST(BFieldElementSimdTest, RejectsMismatchedLengthsAndUnsupportedKernels) {
+    std::vector<BFieldElement> a(4), b(3), out(4);
+    EXPECT_THROW(BFieldElementSimd::add(a, b, out), std::invalid_argument);
+
+    for (SimdKernel kernel : ALL_KERNELS) {
+        if (!BFieldElementSimd::is_supported(kernel)) {
+            EXPECT_THROW(BFieldElementSimd::mul(kernel, a, a, out), std::invalid_argument);
+        }
+    }
+}
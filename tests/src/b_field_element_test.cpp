@@ -21,8 +21,10 @@
 // This file is a part of tip5xx library
 
 #include <gtest/gtest.h>
+#include <array>
 #include <random>
 #include <unordered_set>
+#include "tip5xx/aligned_allocator.hpp"
 #include "tip5xx/b_field_element.hpp"
 #include "random_generator.hpp"
 
@@ -139,6 +141,17 @@ TEST(BFieldElementTest, ZeroIsZero) {
     ASSERT_EQ(zero, BFieldElement::ZERO);
 }
 
+// Constants are usable in constant expressions, so they need no static initialization
+TEST(BFieldElementTest, ConstantsAreConstexpr) {
+    static_assert(BFieldElement::ZERO.raw_u64() == 0, "ZERO must be zero in Montgomery form");
+    static_assert(BFieldElement::ONE.value() == 1, "ONE must be one");
+    static_assert(BFieldElement::MINUS_TWO_INVERSE.value() == 0x7FFFFFFF80000000ULL, "MINUS_TWO_INVERSE mismatch");
+    static_assert(BFieldElement::one().raw_u64() == BFieldElement::ONE.raw_u64(), "one() must match ONE");
+
+    EXPECT_EQ(BFieldElement::ONE, BFieldElement::new_element(1));
+    EXPECT_EQ(BFieldElement::MINUS_TWO_INVERSE * bfe(2), -BFieldElement::ONE);
+}
+
 // Not zero is nonzero test (converted from proptest)
 TEST(BFieldElementTest, NotZeroIsNonzero) {
     RandomGenerator rng;
@@ -369,6 +382,170 @@ TEST(BFieldElementTest, BatchInversion) {
     }
 }
 
+// Span batch inversion splits large inputs into per-thread chunks
+TEST(BFieldElementTest, CyclicGroupElementsIntoCallerStorage) {
+    BFieldElement generator = BFieldElement::primitive_root_of_unity(16);
+    std::vector<BFieldElement> expected = generator.cyclic_group_elements();
+
+    std::vector<BFieldElement> out(20);
+    ASSERT_EQ(generator.cyclic_group_elements_into(out), 16u);
+    EXPECT_EQ(std::vector<BFieldElement>(out.begin(), out.begin() + 16), expected);
+
+    std::vector<BFieldElement> truncated(5);
+    EXPECT_EQ(generator.cyclic_group_elements_into(truncated), 5u);
+    EXPECT_EQ(truncated, generator.cyclic_group_elements(5));
+
+    EXPECT_EQ(BFieldElement::ZERO.cyclic_group_elements_into(out), 1u);
+    EXPECT_EQ(out[0], BFieldElement::ZERO);
+}
+
+// Subgroups of known order are filled in parallel chunks seeded with mod_pow
+TEST(BFieldElementTest, CyclicGroupElementsOfOrder) {
+    const size_t order = size_t{1} << 16;
+    BFieldElement generator = BFieldElement::primitive_root_of_unity(order);
+    EXPECT_EQ(generator.power_of_two_order(), order);
+    EXPECT_EQ(BFieldElement::ONE.power_of_two_order(), 1u);
+    EXPECT_EQ(BFieldElement::ZERO.power_of_two_order(), 0u);
+    EXPECT_EQ(BFieldElement::generator().power_of_two_order(), 0u);
+
+    std::vector<BFieldElement> serial = {BFieldElement::ONE};
+    for (BFieldElement val = generator; !val.is_one(); val *= generator) {
+        serial.push_back(val);
+    }
+    ASSERT_EQ(serial.size(), order);
+    EXPECT_EQ(generator.cyclic_group_elements(), serial);
+    EXPECT_EQ(generator.cyclic_group_elements(1000), std::vector<BFieldElement>(serial.begin(), serial.begin() + 1000));
+    EXPECT_EQ(generator.cyclic_group_elements_of_order(order, BFieldElement::ONE, 4), serial);
+
+    // Coset offset·⟨generator⟩ into caller storage
+    BFieldElement offset = BFieldElement::generator();
+    std::vector<BFieldElement> coset(order);
+    generator.cyclic_group_elements_of_order_into(coset, offset, 3);
+    for (size_t i = 0; i < order; i += 997) {
+        EXPECT_EQ(coset[i], offset * serial[i]) << "i = " << i;
+    }
+    EXPECT_EQ(coset.back(), offset * serial.back());
+
+    // Powers past the order wrap around
+    std::vector<BFieldElement> powers(order + 5);
+    generator.powers_into(powers);
+    EXPECT_EQ(powers[order + 3], serial[3]);
+
+    EXPECT_THROW(generator.cyclic_group_elements_of_order(order / 2), std::invalid_argument);
+    EXPECT_THROW(generator.cyclic_group_elements_of_order(2 * order), std::invalid_argument);
+    EXPECT_THROW(generator.cyclic_group_elements_of_order(0), std::invalid_argument);
+    std::vector<BFieldElement> wrong_size(order - 1);
+    EXPECT_THROW(generator.cyclic_group_elements_of_order_into(wrong_size), std::invalid_argument);
+
+    // Orders that are not powers of two are checked against every prime factor
+    BFieldElement order_three = BFieldElement::generator().mod_pow((BFieldElement::P - 1) / 3);
+    EXPECT_EQ(order_three.cyclic_group_elements_of_order(3), order_three.cyclic_group_elements());
+    BFieldElement order_six = BFieldElement::generator().mod_pow((BFieldElement::P - 1) / 6);
+    EXPECT_EQ(order_six.cyclic_group_elements_of_order(6).size(), 6u);
+    EXPECT_THROW(order_three.cyclic_group_elements_of_order(6), std::invalid_argument);
+}
+
+TEST(BFieldElementTest, BfeVecHelpers) {
+    std::vector<BFieldElement> values = bfe_vec(1, -1, 42u);
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[1], -BFieldElement::ONE);
+    EXPECT_EQ(values[2], BFieldElement::new_element(42));
+
+    auto aligned = createBfeVecWith(AlignedAllocator<BFieldElement, 64>(), 5, 6);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned.data()) % 64, 0u);
+    EXPECT_EQ(aligned[1], BFieldElement::new_element(6));
+
+    std::array<BFieldElement, 4> array = createBfeArray<4>(7, 8);
+    EXPECT_EQ(array[1], BFieldElement::new_element(8));
+    EXPECT_EQ(array[3], BFieldElement::ZERO);
+}
+
+TEST(BFieldElementTest, SpanBatchInversionAcrossChunks) {
+    RandomGenerator rng(61);
+    std::vector<BFieldElement> bfes = rng.random_elements((size_t{1} << 16) + 3);
+    for (auto& e : bfes) {
+        if (e.is_zero()) {
+            e = BFieldElement::ONE;
+        }
+    }
+
+    std::vector<BFieldElement> expected = BFieldElement::batch_inversion(bfes);
+    std::vector<BFieldElement> out(bfes.size());
+    BFieldElement::batch_inversion(bfes, out, 4);
+    EXPECT_EQ(out, expected);
+
+    std::vector<BFieldElement> in_place = bfes;
+    BFieldElement::batch_inversion_in_place(in_place, 3);
+    EXPECT_EQ(in_place, expected);
+
+    std::vector<BFieldElement> scratch(bfes.size() + 5);
+    std::vector<BFieldElement> with_scratch = bfes;
+    BFieldElement::batch_inversion_in_place(with_scratch, scratch, 2);
+    EXPECT_EQ(with_scratch, expected);
+    EXPECT_THROW(BFieldElement::batch_inversion_in_place(with_scratch, span<BFieldElement>(scratch.data(), 7)),
+                 std::invalid_argument);
+
+    for (size_t i = 0; i < bfes.size(); i += 997) {
+        EXPECT_EQ(expected[i], bfes[i].inverse()) << "Failed at index " << i;
+    }
+}
+
+// Zero-tolerant batch inversion maps zeros to zero
+TEST(BFieldElementTest, BatchInversionOrZero) {
+    RandomGenerator rng(62);
+    std::vector<BFieldElement> bfes = rng.random_elements(size_t{1} << 15);
+    bfes[0] = BFieldElement::ZERO;
+    bfes[12345] = BFieldElement::ZERO;
+    bfes.back() = BFieldElement::ZERO;
+
+    std::vector<BFieldElement> out(bfes.size());
+    BFieldElement::batch_inversion_or_zero(bfes, out, 2);
+    std::vector<BFieldElement> in_place = bfes;
+    BFieldElement::batch_inversion_or_zero_in_place(in_place, 2);
+
+    for (size_t i = 0; i < bfes.size(); i++) {
+        ASSERT_EQ(out[i], bfes[i].inverse_or_zero()) << "Failed at index " << i;
+    }
+    EXPECT_EQ(in_place, out);
+}
+
+// Strict batch inversion rejects zeros and mismatched sizes
+TEST(BFieldElementTest, BatchInversionRejectsZeroAndSizeMismatch) {
+    std::vector<BFieldElement> bfes = {bfe(3), BFieldElement::ZERO, bfe(5)};
+    std::vector<BFieldElement> out(bfes.size());
+    EXPECT_THROW(BFieldElement::batch_inversion(bfes, out), BFieldElementInverseError);
+    EXPECT_THROW(BFieldElement::batch_inversion_in_place(bfes), BFieldElementInverseError);
+
+    std::vector<BFieldElement> short_out(2);
+    EXPECT_THROW(BFieldElement::batch_inversion(bfes, short_out), std::invalid_argument);
+}
+
+// Out-of-place batch inversion into its own input runs in place
+TEST(BFieldElementTest, BatchInversionHandlesAliasedOutput) {
+    RandomGenerator rng(512);
+    std::vector<BFieldElement> values = rng.random_elements(100000);
+    for (auto& value : values) {
+        if (value.is_zero()) {
+            value = BFieldElement::ONE;
+        }
+    }
+    values[7] = BFieldElement::ZERO;
+    std::vector<BFieldElement> expected = BFieldElement::batch_inversion(std::vector<BFieldElement>(values.begin() + 8, values.end()));
+
+    std::vector<BFieldElement> aliased(values.begin() + 8, values.end());
+    BFieldElement::batch_inversion(aliased, aliased);
+    EXPECT_EQ(aliased, expected);
+
+    std::vector<BFieldElement> with_zero = values;
+    BFieldElement::batch_inversion_or_zero(with_zero, with_zero);
+    EXPECT_EQ(with_zero[7], BFieldElement::ZERO);
+    EXPECT_EQ(std::vector<BFieldElement>(with_zero.begin() + 8, with_zero.end()), expected);
+
+    span<BFieldElement> all(values);
+    EXPECT_THROW(BFieldElement::batch_inversion(all.first(10), all.subspan(5, 10)), std::invalid_argument);
+    EXPECT_THROW(BFieldElement::batch_inversion_or_zero(all.subspan(5, 10), all.first(10)), std::invalid_argument);
+}
+
 // Multiplicative inverse of zero test (converted from test)
 TEST(BFieldElementTest, MultiplicativeInverseOfZero) {
     BFieldElement zero = BFieldElement::ZERO;
@@ -534,6 +711,46 @@ TEST(BFieldElementTest, EqualityAndHashTest) {
 //    EXPECT_EQ(expected, a + b);
 //}
 
+// Reference square-and-multiply for checking the windowed mod_pow
+static BFieldElement naive_pow(BFieldElement base, uint64_t exp) {
+    BFieldElement acc = BFieldElement::ONE;
+    while (exp != 0) {
+        if (exp & 1) {
+            acc *= base;
+        }
+        base *= base;
+        exp >>= 1;
+    }
+    return acc;
+}
+
+TEST(BFieldElementTest, ModPowMatchesReference) {
+    RandomGenerator rng(71);
+    const std::vector<uint64_t> edge_exponents = {0, 1, 2, 3, 15, 16, 255, 256, 257, 0xFFFF,
+                                                  BFieldElement::P - 2, BFieldElement::MAX, UINT64_MAX};
+    for (int i = 0; i < 50; i++) {
+        BFieldElement base = rng.random_bfe();
+        uint64_t exp = rng.random_range<uint64_t>(UINT64_MAX);
+        EXPECT_EQ(base.mod_pow(exp), naive_pow(base, exp)) << "exp = " << exp;
+        for (uint64_t e : edge_exponents) {
+            EXPECT_EQ(base.mod_pow(e), naive_pow(base, e)) << "exp = " << e;
+        }
+    }
+}
+
+TEST(BFieldElementTest, FixedExponentPow) {
+    static_assert(BFieldElement::new_element(2).pow<7>().value() == 128, "2^7 must be 128");
+    static_assert(BFieldElement::new_element(5).pow<0>().value() == 1, "x^0 must be 1");
+
+    RandomGenerator rng(72);
+    for (int i = 0; i < 20; i++) {
+        BFieldElement x = rng.random_bfe();
+        EXPECT_EQ(x.pow<7>(), x.mod_pow(7));
+        EXPECT_EQ(x.pow<65537>(), x.mod_pow(65537));
+        EXPECT_EQ(x.pow<BFieldElement::P - 1>(), x.is_zero() ? BFieldElement::ZERO : BFieldElement::ONE);
+    }
+}
+
 // Test mod_pow_test_powers_of_two
 TEST(BFieldElementTest, ModPowPowersOfTwo) {
     BFieldElement two = BFieldElement::new_element(2);
@@ -970,6 +1187,20 @@ TEST(BFieldElementTest, PrimitiveRootOfUnity) {
     }
 }
 
+// The primitive root table is indexed at compile time
+TEST(BFieldElementTest, PrimitiveRootOfUnityIsConstexpr) {
+    constexpr BFieldElement root_16 = BFieldElement::primitive_root_of_unity(16);
+    static_assert(root_16.value() == 17293822564807737345ULL, "root of order 16 mismatch");
+    static_assert(BFieldElement::primitive_root_of_unity(0).value() == 1, "order 0 maps to one");
+    static_assert(BFieldElement::primitive_root_of_unity(1ULL << 32).value() == 1753635133440165772ULL,
+                  "root of order 2^32 mismatch");
+
+    for (size_t k = 0; k <= BFieldElement::MAX_TWO_ADICITY; k++) {
+        BFieldElement root = BFieldElement::primitive_root_of_unity(1ULL << k);
+        EXPECT_TRUE(root.mod_pow(1ULL << k).is_one()) << "k = " << k;
+    }
+}
+
 // Test cyclic_group_elements method
 TEST(BFieldElementTest, CyclicGroupElements) {
     // Test small groups
@@ -1122,6 +1353,93 @@ TEST(BFieldElementTest, BfeFromString) {
     EXPECT_THROW((void)bfe_from_string(large_value), BFieldElementStringConversionError);
 }
 
+TEST(BFieldElementTest, BfeFromCharsAndParse) {
+    const char text[] = "-42,rest";
+    BFieldElement value;
+    std::from_chars_result result = bfe_from_chars(text, text + sizeof(text) - 1, value);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, text + 3);
+    EXPECT_EQ(value, BFieldElement::new_element(BFieldElement::P - 42));
+
+    const char hex[] = "ffffffff00000001";
+    result = bfe_from_chars(hex, hex + 16, value, 16);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(value, BFieldElement::ZERO);
+
+    BFieldElement untouched = BFieldElement::new_element(7);
+    const char too_large[] = "18446744069414584321";
+    result = bfe_from_chars(too_large, too_large + 20, untouched);
+    EXPECT_EQ(result.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(result.ptr, too_large + 20);
+    EXPECT_EQ(untouched, BFieldElement::new_element(7));
+    result = bfe_from_chars(text + 4, text + 8, untouched);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(result.ptr, text + 4);
+
+    // bfe_parse accepts what bfe_from_string accepts, except that a lone sign
+    // is rejected rather than read as zero
+    for (const char* input : {"0", "42", " +42 ", "-1", "18446744069414584320", "-18446744069414584320",
+                              "0x10", "0xFFFFFFFFFFFFFFFFFF"}) {
+        ASSERT_EQ(bfe_parse(input, value), std::errc()) << input;
+        EXPECT_EQ(value, bfe_from_string(input)) << input;
+    }
+    for (const char* input : {"", " ", "abc", "123abc", "42.5", "+-5", "0x", "0xg"}) {
+        EXPECT_EQ(bfe_parse(input, value), std::errc::invalid_argument) << input;
+        EXPECT_THROW((void)bfe_from_string(input), BFieldElementStringConversionError) << input;
+    }
+    for (const char* input : {"18446744069414584321", "-18446744069414584321", "99999999999999999999999"}) {
+        EXPECT_EQ(bfe_parse(input, value), std::errc::result_out_of_range) << input;
+        EXPECT_THROW((void)bfe_from_string(input), BFieldElementStringConversionError) << input;
+    }
+}
+
+// bfe_from_string keeps reading a lone sign as zero; bfe_parse rejects it
+TEST(BFieldElementTest, ParseRejectsLoneSign) {
+    BFieldElement value = bfe(7);
+    for (const char* input : {"-", "+", " - "}) {
+        EXPECT_EQ(bfe_from_string(input), BFieldElement::ZERO) << input;
+        EXPECT_EQ(bfe_parse(input, value), std::errc::invalid_argument) << input;
+        EXPECT_EQ(value, bfe(7)) << input;
+    }
+}
+
+TEST(BFieldElementTest, ParseBfeList) {
+    std::vector<BFieldElement> out = {BFieldElement::ONE};
+    BfeListParseResult result = parse_bfe_list("1, 2,,-3\n0x4\r\n\n 5\n", out);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result.parsed, 5u);
+    EXPECT_EQ(out, std::vector<BFieldElement>({BFieldElement::ONE, bfe(1), bfe(2), -bfe(3), bfe(4), bfe(5)}));
+
+    result = parse_bfe_list("1,2\n3x,4", out);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(result.error_offset, 4u);
+    EXPECT_EQ(result.parsed, 0u);
+    EXPECT_EQ(out.size(), 6u);
+
+    // Large enough to be split across threads
+    RandomGenerator rng(231);
+    std::vector<BFieldElement> expected = rng.random_elements(200000);
+    std::string text;
+    for (size_t i = 0; i < expected.size(); i++) {
+        text += std::to_string(expected[i].value());
+        text += i % 5 == 4 ? "\n" : ", ";
+    }
+    std::vector<BFieldElement> parsed;
+    result = parse_bfe_list(text, parsed, 4);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(parsed, expected);
+
+    size_t bad = text.size() - 100;
+    bad = text.find_first_of("0123456789", bad);
+    text[bad] = '?';
+    parsed.clear();
+    result = parse_bfe_list(text, parsed, 4);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(text.find_last_of(", \n", result.error_offset) + 1, result.error_offset);
+    EXPECT_LE(result.error_offset, bad);
+    EXPECT_TRUE(parsed.empty());
+}
+
 TEST(BFieldElementTest, BfeFromHexString) {
     // Test basic hex values
     EXPECT_EQ(BFieldElement::new_element(0), bfe_from_string("0x0"));
@@ -1417,3 +1735,23 @@ TEST(BFieldElementTest, ModReduce) {
         EXPECT_EQ(expected, result) << "Failed for hi=" << hi << ", lo=" << lo;
     }
 }
+
+TEST(BFieldElementTest, PowerAccumulatorMatchesModPow) {
+    RandomGenerator rng(44);
+    std::array<BFieldElement, 16> base;
+    std::array<BFieldElement, 16> tail;
+    for (size_t j = 0; j < base.size(); j++) {
+        base[j] = rng.random_bfe();
+        tail[j] = rng.random_bfe();
+    }
+
+    std::array<BFieldElement, 16> result = BFieldElement::power_accumulator<16, 7>(base, tail);
+    for (size_t j = 0; j < base.size(); j++) {
+        EXPECT_EQ(result[j], base[j].mod_pow(1 << 7) * tail[j]) << "Lane " << j;
+    }
+
+    std::array<BFieldElement, 3> odd_base = {base[0], base[1], base[2]};
+    std::array<BFieldElement, 3> odd_tail = {tail[0], tail[1], tail[2]};
+    std::array<BFieldElement, 3> odd = BFieldElement::power_accumulator<3, 0>(odd_base, odd_tail);
+    EXPECT_EQ(odd[2], base[2] * tail[2]);
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "tip5xx/byte_sponge.hpp"
+#include "tip5xx/tip5xx.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+uint8_t rotl8(uint8_t x, unsigned int n) {
+    return static_cast<uint8_t>((x << n) | (x >> (8 - n)));
+}
+
+// Straightforward permutation with runtime bounds and modular neighbour indices
+void reference_permute(std::vector<uint8_t>& state, size_t rounds) {
+    size_t n = state.size();
+    std::vector<uint8_t> temp(n);
+    for (size_t round = 0; round < rounds; ++round) {
+        state[0] ^= detail::BYTE_ROUND_CONSTANTS[round];
+        for (auto& x : state) {
+            x = static_cast<uint8_t>(x + rotl8(x, 2));
+            x = static_cast<uint8_t>(x ^ (x >> 1));
+        }
+        for (size_t i = 0; i < n; ++i) {
+            temp[i] = state[i] ^ rotl8(state[(i + n - 1) % n], 1) ^ rotl8(state[(i + 1) % n], 2);
+        }
+        state = temp;
+    }
+}
+
+template <size_t StateSize, size_t Rounds>
+void expect_matches_reference(RandomGenerator& rng) {
+    typename BytePermutation<StateSize, Rounds>::State state;
+    for (auto& byte : state) {
+        byte = static_cast<uint8_t>(rng.random_range<uint32_t>(0, 255));
+    }
+    std::vector<uint8_t> expected(state.begin(), state.end());
+
+    BytePermutation<StateSize, Rounds>::permute(state);
+    reference_permute(expected, Rounds);
+    EXPECT_EQ(std::vector<uint8_t>(state.begin(), state.end()), expected)
+        << "StateSize " << StateSize << ", Rounds " << Rounds;
+}
+
+} // namespace
+
+TEST(ByteSpongeTest, PermutationMatchesReference) {
+    RandomGenerator rng(271);
+    expect_matches_reference<63, 80>(rng);
+    expect_matches_reference<3, 1>(rng);
+    expect_matches_reference<16, 7>(rng);
+    expect_matches_reference<127, 80>(rng);
+}
+
+TEST(ByteSpongeTest, Tip5IsAnInstantiation) {
+    static_assert(Tip5::Sponge::STATE_SIZE == Tip5::STATE_SIZE && Tip5::Sponge::RATE == Tip5::RATE &&
+                  Tip5::Sponge::ROUNDS == Tip5::ROUNDS, "Tip5 parameters");
+    std::vector<uint8_t> left(45, 0x11);
+    std::vector<uint8_t> right(7, 0x22);
+    std::vector<uint8_t> expected = Tip5::hash_pair(left, right);
+
+    ByteSponge<63, 31, 80>::Hash hash = ByteSponge<63, 31, 80>::hash_pair(left, right);
+    EXPECT_EQ(std::vector<uint8_t>(hash.begin(), hash.end()), expected);
+}
+
+TEST(ByteSpongeTest, WideRateVariant) {
+    using Wide = ByteSponge<127, 95, 80, 64>;
+    static_assert(Wide::CAPACITY == 32, "capacity");
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    Wide::Hash a = Wide::hash_pair(data, {});
+    data[999] ^= 1;
+    Wide::Hash b = Wide::hash_pair(data, {});
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a.size(), 64u);
+
+    // Absorbing a block is an XOR into the rate followed by one permutation
+    Wide::State state{};
+    Wide::absorb(state, data.data(), Wide::RATE);
+    Wide::State expected{};
+    for (size_t i = 0; i < Wide::RATE; i++) {
+        expected[i] = data[i];
+    }
+    Wide::permute(expected);
+    EXPECT_EQ(state, expected);
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "tip5xx/executor.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/parallel.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+// Runs every task on the calling thread and counts batches
+class CountingExecutor : public Executor {
+public:
+    size_t concurrency() const override { return 4; }
+
+    void bulk(size_t count, const std::function<void(size_t)>& task, size_t) override {
+        batches++;
+        for (size_t i = 0; i < count; i++) {
+            task(i);
+        }
+    }
+
+    std::atomic<size_t> batches{0};
+};
+
+} // namespace
+
+TEST(ExecutorTest, BulkRunsEveryTaskOnce) {
+    WorkStealingExecutor executor(4);
+    EXPECT_EQ(executor.concurrency(), 4u);
+    for (size_t count : {size_t{1}, size_t{3}, size_t{1000}}) {
+        std::vector<std::atomic<int>> runs(count);
+        executor.bulk(count, [&](size_t i) {
+            // Uneven tasks make idle threads steal
+            if (i % 7 == 0) {
+                std::this_thread::yield();
+            }
+            runs[i]++;
+        }, 0);
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(runs[i].load(), 1) << "count " << count << ", task " << i;
+        }
+    }
+}
+
+TEST(ExecutorTest, BulkRespectsThreadLimit) {
+    WorkStealingExecutor executor(4);
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    executor.bulk(2000, [&](size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    }, 2);
+    EXPECT_LE(ids.size(), 2u);
+
+    ids.clear();
+    executor.bulk(100, [&](size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    }, 1);
+    EXPECT_EQ(ids, std::set<std::thread::id>{std::this_thread::get_id()});
+}
+
+TEST(ExecutorTest, NestedParallelForRunsInline) {
+    WorkStealingExecutor executor(3);
+    std::vector<std::atomic<int>> visits(64 * 64);
+    parallel_for(executor, 64, 1, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; row++) {
+            parallel_for(executor, 64, 1, [&](size_t b, size_t e) {
+                for (size_t col = b; col < e; col++) {
+                    visits[row * 64 + col]++;
+                }
+            });
+        }
+    });
+    for (size_t i = 0; i < visits.size(); i++) {
+        EXPECT_EQ(visits[i].load(), 1) << "Index " << i;
+    }
+}
+
+TEST(ExecutorTest, ParallelForPropagatesExceptions) {
+    WorkStealingExecutor executor(4);
+    EXPECT_THROW(parallel_for(executor, 1000, 1, [](size_t begin, size_t) {
+        if (begin == 0) {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+
+    // The pool stays usable
+    std::atomic<size_t> sum{0};
+    parallel_for(executor, 100, 1, [&](size_t begin, size_t end) { sum += end - begin; });
+    EXPECT_EQ(sum.load(), 100u);
+}
+
+TEST(ExecutorTest, PinnedExecutorRuns) {
+    WorkStealingExecutor::Options options;
+    options.num_threads = 2;
+    options.pin_threads = true;
+    WorkStealingExecutor executor(options);
+    EXPECT_GE(executor.numa_nodes(), 1u);
+
+    std::atomic<size_t> sum{0};
+    executor.bulk(500, [&](size_t i) { sum += i; }, 0);
+    EXPECT_EQ(sum.load(), 500u * 499u / 2);
+}
+
+TEST(ExecutorTest, DefaultExecutorCanBeReplaced) {
+    auto counting = std::make_shared<CountingExecutor>();
+    set_default_executor(counting);
+    EXPECT_EQ(default_thread_count(), 4u);
+
+    std::vector<Digest> leaves(1 << 12);
+    Digest root = MerkleTree(leaves).root();
+    EXPECT_GT(counting->batches.load(), 0u);
+
+    set_default_executor(nullptr);
+    EXPECT_EQ(default_executor()->concurrency(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+    EXPECT_EQ(MerkleTree(leaves).root(), root);
+}
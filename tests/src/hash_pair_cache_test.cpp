@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "tip5xx/hash_pair_cache.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+TEST(HashPairCacheTest, RepeatedPairsHitTheCache) {
+    RandomGenerator rng(181);
+    std::vector<Digest> digests = rng.random_digests(8);
+    HashPairCache cache(1024, 4);
+
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i + 1 < digests.size(); i += 2) {
+            EXPECT_EQ(cache.hash_pair(digests[i], digests[i + 1]),
+                      Tip5Sponge::hash_pair(digests[i], digests[i + 1]));
+        }
+    }
+
+    HashPairCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.hits, 8u);
+    EXPECT_EQ(stats.evictions, 0u);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 8.0 / 12.0);
+
+    // Order of the inputs is part of the key
+    EXPECT_EQ(cache.hash_pair(digests[1], digests[0]), Tip5Sponge::hash_pair(digests[1], digests[0]));
+    EXPECT_EQ(cache.stats().misses, 5u);
+
+    cache.reset_stats();
+    EXPECT_DOUBLE_EQ(cache.stats().hit_rate(), 0.0);
+    cache.clear();
+    cache.hash_pair(digests[0], digests[1]);
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST(HashPairCacheTest, EvictsWhenFullAndStaysCorrect) {
+    RandomGenerator rng(182);
+    std::vector<Digest> digests = rng.random_digests(257);
+    HashPairCache cache(16, 1);
+    EXPECT_EQ(cache.capacity(), 16u);
+
+    for (size_t i = 0; i + 1 < digests.size(); i++) {
+        EXPECT_EQ(cache.hash_pair(digests[i], digests[i + 1]),
+                  Tip5Sponge::hash_pair(digests[i], digests[i + 1]));
+    }
+    EXPECT_GE(cache.stats().evictions, 256u - 16u);
+
+    // A pair kept hot survives a stream of one-shot pairs
+    cache.reset_stats();
+    for (size_t i = 0; i + 1 < digests.size(); i++) {
+        cache.hash_pair(digests[0], digests[0]);
+        cache.hash_pair(digests[i + 1], digests[i]);
+    }
+    EXPECT_GE(cache.stats().hits, 250u);
+}
+
+TEST(HashPairCacheTest, ConcurrentUseMatchesDirectHashing) {
+    RandomGenerator rng(183);
+    std::vector<Digest> digests = rng.random_digests(64);
+    std::vector<Digest> expected(digests.size() - 1);
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] = Tip5Sponge::hash_pair(digests[i], digests[i + 1]);
+    }
+
+    HashPairCache cache(32, 4);
+    std::vector<std::thread> workers;
+    std::vector<int> mismatches(4, 0);
+    for (size_t t = 0; t < mismatches.size(); t++) {
+        workers.emplace_back([&, t] {
+            for (int round = 0; round < 20; round++) {
+                for (size_t i = 0; i < expected.size(); i++) {
+                    mismatches[t] += cache.hash_pair(digests[i], digests[i + 1]) != expected[i];
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (int count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+    HashPairCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 4u * 20u * expected.size());
+}
+
+TEST(HashPairCacheTest, RejectsEmptyConfiguration) {
+    EXPECT_THROW(HashPairCache(0, 1), std::invalid_argument);
+    EXPECT_THROW(HashPairCache(16, 0), std::invalid_argument);
+}
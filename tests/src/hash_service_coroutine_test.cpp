@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+// Built as C++20 by tip5xx_coroutine_tests so HashService::async_hash_pair is compiled and run
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <vector>
+#include "tip5xx/hash_service.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+#if TIP5XX_HAS_COROUTINES
+
+namespace {
+
+// Eagerly started coroutine that nobody awaits
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Awaits every pair in turn; each later request is enqueued from the service thread
+DetachedTask hash_in_sequence(HashService& service, const std::vector<Digest>& lefts,
+                              const std::vector<Digest>& rights, std::promise<std::vector<Digest>>& done) {
+    std::vector<Digest> digests;
+    for (size_t i = 0; i < lefts.size(); i++) {
+        digests.push_back(co_await service.async_hash_pair(lefts[i], rights[i]));
+    }
+    done.set_value(std::move(digests));
+}
+
+DetachedTask hash_one(HashService& service, Digest left, Digest right, Digest& out,
+                      std::atomic<size_t>& remaining, std::promise<void>& done) {
+    out = co_await service.async_hash_pair(left, right);
+    if (remaining.fetch_sub(1) == 1) {
+        done.set_value();
+    }
+}
+
+} // namespace
+
+TEST(HashServiceCoroutineTest, SequentialAwaitsMatchHashPair) {
+    RandomGenerator rng(262);
+    std::vector<Digest> lefts, rights;
+    for (size_t i = 0; i < 20; i++) {
+        lefts.push_back(rng.random_digest());
+        rights.push_back(rng.random_digest());
+    }
+
+    HashService service;
+    std::promise<std::vector<Digest>> done;
+    std::future<std::vector<Digest>> result = done.get_future();
+    hash_in_sequence(service, lefts, rights, done);
+    std::vector<Digest> digests = result.get();
+
+    ASSERT_EQ(digests.size(), lefts.size());
+    for (size_t i = 0; i < digests.size(); i++) {
+        EXPECT_EQ(digests[i], Tip5Sponge::hash_pair(lefts[i], rights[i])) << "Request " << i;
+    }
+}
+
+TEST(HashServiceCoroutineTest, ConcurrentAwaitsAreBatched) {
+    RandomGenerator rng(263);
+    const size_t n = 64;
+    std::vector<Digest> lefts, rights;
+    for (size_t i = 0; i < n; i++) {
+        lefts.push_back(rng.random_digest());
+        rights.push_back(rng.random_digest());
+    }
+
+    HashService::Options options;
+    options.max_wait = std::chrono::milliseconds(20);
+    HashService service(options);
+    std::vector<Digest> digests(n);
+    std::atomic<size_t> remaining{n};
+    std::promise<void> done;
+    std::future<void> finished = done.get_future();
+    for (size_t i = 0; i < n; i++) {
+        hash_one(service, lefts[i], rights[i], digests[i], remaining, done);
+    }
+    finished.get();
+
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(digests[i], Tip5Sponge::hash_pair(lefts[i], rights[i])) << "Request " << i;
+    }
+    EXPECT_EQ(service.stats().requests, n);
+    EXPECT_LT(service.stats().batches, n);
+}
+
+#else
+
+TEST(HashServiceCoroutineTest, SequentialAwaitsMatchHashPair) {
+    GTEST_SKIP() << "The compiler does not support C++20 coroutines";
+}
+
+#endif
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "tip5xx/hash_service.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+TEST(HashServiceTest, MatchesHashPair) {
+    RandomGenerator rng(261);
+    HashService service;
+    std::vector<Digest> lefts, rights;
+    std::vector<std::future<Digest>> futures;
+    for (size_t i = 0; i < 100; i++) {
+        lefts.push_back(rng.random_digest());
+        rights.push_back(rng.random_digest());
+        futures.push_back(service.hash_pair(lefts.back(), rights.back()));
+    }
+    for (size_t i = 0; i < futures.size(); i++) {
+        EXPECT_EQ(futures[i].get(), Tip5Sponge::hash_pair(lefts[i], rights[i])) << "Request " << i;
+    }
+    EXPECT_EQ(service.stats().requests, 100u);
+}
+
+TEST(HashServiceTest, CoalescesConcurrentRequests) {
+    HashService::Options options;
+    options.max_batch = 32;
+    options.max_wait = std::chrono::milliseconds(100);
+    HashService service(options);
+
+    RandomGenerator rng(262);
+    Digest left = rng.random_digest();
+    std::vector<std::thread> clients;
+    std::vector<Digest> results(4 * 64);
+    for (size_t t = 0; t < 4; t++) {
+        clients.emplace_back([&, t] {
+            for (size_t i = 0; i < 64; i++) {
+                Digest right;
+                right[0] = BFieldElement::new_element(t * 64 + i);
+                results[t * 64 + i] = service.hash_pair(left, right).get();
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    for (size_t i = 0; i < results.size(); i++) {
+        Digest right;
+        right[0] = BFieldElement::new_element(i);
+        EXPECT_EQ(results[i], Tip5Sponge::hash_pair(left, right)) << "Request " << i;
+    }
+
+    // Burst submission fills whole batches
+    HashService::Stats before = service.stats();
+    std::vector<std::future<Digest>> futures;
+    for (size_t i = 0; i < 256; i++) {
+        futures.push_back(service.hash_pair(left, left));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+    HashService::Stats after = service.stats();
+    EXPECT_EQ(after.requests - before.requests, 256u);
+    EXPECT_LT(after.batches - before.batches, 256u / Tip5Sponge::BATCH_LANES + 2);
+    EXPECT_GT(after.mean_batch_size(), 1.0);
+}
+
+TEST(HashServiceTest, LoneRequestCompletesAfterMaxWait) {
+    HashService::Options options;
+    options.max_wait = std::chrono::milliseconds(2);
+    HashService service(options);
+
+    std::future<Digest> future = service.hash_pair(Digest(), Digest());
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(future.get(), Tip5Sponge::hash_pair(Digest(), Digest()));
+    EXPECT_EQ(service.stats().batches, 1u);
+}
+
+TEST(HashServiceTest, DestructorDrainsQueue) {
+    std::vector<std::future<Digest>> futures;
+    {
+        HashService::Options options;
+        options.max_wait = std::chrono::seconds(10);
+        HashService service(options);
+        for (size_t i = 0; i < 5; i++) {
+            futures.push_back(service.hash_pair(Digest(), Digest()));
+        }
+    }
+    for (auto& future : futures) {
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_EQ(future.get(), Tip5Sponge::hash_pair(Digest(), Digest()));
+    }
+}
+
+TEST(HashServiceTest, EnqueueCallsCompletion) {
+    HashService service;
+    std::promise<Digest> promise;
+    service.enqueue(Digest(), Digest(), [](void* context, const Digest& digest) {
+        static_cast<std::promise<Digest>*>(context)->set_value(digest);
+    }, &promise);
+    EXPECT_EQ(promise.get_future().get(), Tip5Sponge::hash_pair(Digest(), Digest()));
+
+    HashService::Options options;
+    options.max_batch = 0;
+    EXPECT_THROW(HashService{options}, std::invalid_argument);
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/instrumentation.hpp"
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "tip5xx/tip5xx.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+struct TraceLog {
+    std::vector<std::string> begun;
+    std::vector<std::string> ended;
+};
+
+void record_begin(const char* name, void* user_data) {
+    static_cast<TraceLog*>(user_data)->begun.emplace_back(name);
+}
+
+void record_end(const char* name, uint64_t, void* user_data) {
+    static_cast<TraceLog*>(user_data)->ended.emplace_back(name);
+}
+
+struct TraceCounts {
+    std::atomic<uint64_t> begun{0};
+    std::atomic<uint64_t> ended{0};
+};
+
+void count_begin(const char*, void* user_data) {
+    static_cast<TraceCounts*>(user_data)->begun++;
+}
+
+void count_end(const char*, uint64_t, void* user_data) {
+    static_cast<TraceCounts*>(user_data)->ended++;
+}
+
+} // namespace
+
+TEST(InstrumentationTest, CountsSpongeWork) {
+    reset_thread_counters();
+    Digest left(Digest::Values{BFieldElement::new_element(1), BFieldElement::new_element(2),
+                               BFieldElement::new_element(3), BFieldElement::new_element(4),
+                               BFieldElement::new_element(5)});
+    Tip5Sponge::hash_pair(left, left);
+    Tip5Sponge::hash_varlen(std::vector<BFieldElement>(15, BFieldElement::ONE));
+    BFieldElement::new_element(7).inverse();
+
+    InstrumentationCounters counters = thread_counters();
+    if (!INSTRUMENTATION_ENABLED) {
+        EXPECT_EQ(counters.permutations, 0u);
+        EXPECT_EQ(counters.absorbed_blocks, 0u);
+        EXPECT_EQ(counters.squeezes, 0u);
+        EXPECT_EQ(counters.inversions, 0u);
+        return;
+    }
+    // hash_pair: one block; hash_varlen of 15 elements: two padded blocks and one squeeze
+    EXPECT_EQ(counters.absorbed_blocks, 3u);
+    EXPECT_EQ(counters.squeezes, 1u);
+    EXPECT_EQ(counters.permutations, 4u);
+    EXPECT_EQ(counters.inversions, 1u);
+
+    reset_thread_counters();
+    EXPECT_EQ(thread_counters().permutations, 0u);
+}
+
+// A length prefix that crosses the rate boundary fills a block like input bytes do
+TEST(InstrumentationTest, CountsVarlenLengthPrefixBlocks) {
+    std::vector<uint8_t> first(20, 0x11);
+    std::vector<uint8_t> second;
+    std::vector<span<const uint8_t>> inputs = {first, second};
+
+    reset_thread_counters();
+    Tip5::hash_varlen_sponge(span<const span<const uint8_t>>(inputs));
+    // 8 + 20 bytes, then the second prefix crosses byte 31; the padded block is the second
+    EXPECT_EQ(thread_counters().absorbed_blocks, INSTRUMENTATION_ENABLED ? 2u : 0u);
+}
+
+TEST(InstrumentationTest, CountersArePerThread) {
+    reset_thread_counters();
+    std::thread worker([] {
+        Tip5::Hash hash;
+        std::vector<uint8_t> data(100, 0x5a);
+        Tip5::hash_pair(data, data, hash);
+        EXPECT_EQ(thread_counters().byte_permutations > 0, INSTRUMENTATION_ENABLED);
+    });
+    worker.join();
+    EXPECT_EQ(thread_counters().byte_permutations, 0u);
+}
+
+TEST(InstrumentationTest, TraceHooksSeeInstrumentedScopes) {
+    auto shared_log = std::make_shared<TraceLog>();
+    const TraceLog& log = *shared_log;
+    TraceHooks hooks;
+    hooks.begin = record_begin;
+    hooks.end = record_end;
+    hooks.user_data = shared_log;
+    set_trace_hooks(hooks);
+
+    std::vector<Digest> leaves(4);
+    MerkleTree tree(leaves, 1);
+    {
+        ScopedTrace scope("caller");
+    }
+    set_trace_hooks(TraceHooks{});
+    {
+        ScopedTrace ignored("after removal");
+    }
+
+    // Explicit scopes always report; library scopes only when instrumented
+    ASSERT_FALSE(log.begun.empty());
+    EXPECT_EQ(log.begun.back(), "caller");
+    EXPECT_EQ(log.ended.back(), "caller");
+    EXPECT_EQ(log.begun.size(), log.ended.size());
+    bool saw_tree = false;
+    for (const std::string& name : log.begun) {
+        saw_tree = saw_tree || name == "tip5xx::MerkleTree::build";
+    }
+    EXPECT_EQ(saw_tree, INSTRUMENTATION_ENABLED);
+}
+
+// A running scope keeps the tracer it began with alive after the hooks are removed
+TEST(InstrumentationTest, RunningScopesOwnTheirTracer) {
+    auto tracer = std::make_shared<TraceLog>();
+    std::weak_ptr<TraceLog> weak_tracer = tracer;
+    TraceHooks hooks;
+    hooks.begin = record_begin;
+    hooks.end = record_end;
+    hooks.user_data = std::move(tracer);
+    set_trace_hooks(hooks);
+    hooks = TraceHooks{};
+
+    {
+        ScopedTrace scope("outlives removal");
+        set_trace_hooks(TraceHooks{});
+        ASSERT_FALSE(weak_tracer.expired());
+        EXPECT_EQ(weak_tracer.lock()->ended.size(), 0u);
+    }
+    EXPECT_TRUE(weak_tracer.expired());
+}
+
+// Scopes reference a hook set that may be replaced while they run
+TEST(InstrumentationTest, TraceHooksCanBeReplacedWhileScopesRun) {
+    auto shared_counts = std::make_shared<TraceCounts>();
+    const TraceCounts& counts = *shared_counts;
+    TraceHooks hooks;
+    hooks.begin = count_begin;
+    hooks.end = count_end;
+    hooks.user_data = shared_counts;
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&done] {
+            while (!done.load()) {
+                ScopedTrace scope("replaced");
+            }
+        });
+    }
+    for (int i = 0; i < 2000; i++) {
+        set_trace_hooks(i % 2 == 0 ? hooks : TraceHooks{});
+    }
+    set_trace_hooks(TraceHooks{});
+    done = true;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counts.begun.load(), counts.ended.load());
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/merkle_tree_file.hpp"
+#include "tip5xx/tip5_hasher.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+// Removes the file when the test ends
+struct TempPath {
+    std::string path;
+
+    explicit TempPath(const std::string& name)
+        : path(::testing::TempDir() + "tip5xx_" + name + ".mkl") {}
+    ~TempPath() { std::remove(path.c_str()); }
+};
+
+Digest write_tree(const std::string& path, const std::vector<Digest>& leaves, size_t step) {
+    MerkleTreeFileWriter writer(path, leaves.size());
+    for (size_t i = 0; i < leaves.size(); i += step) {
+        size_t n = std::min(step, leaves.size() - i);
+        writer.append_leaves(span<const Digest>(leaves.data() + i, n));
+    }
+    return writer.finish();
+}
+
+} // namespace
+
+TEST(MerkleTreeFileTest, MatchesInMemoryTree) {
+    RandomGenerator rng(241);
+    for (size_t n : {size_t{1}, size_t{2}, size_t{8}, size_t{64}}) {
+        TempPath file("match_" + std::to_string(n));
+        std::vector<Digest> leaves = rng.random_digests(n);
+        MerkleTree tree(leaves);
+
+        EXPECT_EQ(write_tree(file.path, leaves, 3), tree.root());
+        MerkleTreeFile on_disk(file.path);
+        EXPECT_EQ(on_disk.num_leafs(), tree.num_leafs());
+        EXPECT_EQ(on_disk.height(), tree.height());
+        EXPECT_EQ(on_disk.root(), tree.root());
+        for (size_t index = 1; index < 2 * n; index++) {
+            EXPECT_EQ(on_disk.node(index), tree.node(index)) << "n = " << n << ", node " << index;
+        }
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(on_disk.leaf(i), leaves[i]);
+            EXPECT_EQ(on_disk.authentication_path(i), tree.authentication_path(i));
+        }
+    }
+}
+
+TEST(MerkleTreeFileTest, SpansSeveralChunks) {
+    RandomGenerator rng(242);
+    size_t n = 4 * MerkleTreeFileWriter::CHUNK_LEAVES;
+    std::vector<Digest> leaves = rng.random_digests(n);
+    MerkleTree tree(leaves);
+    TempPath file("chunks");
+
+    EXPECT_EQ(write_tree(file.path, leaves, 5000), tree.root());
+    MerkleTreeFile on_disk(file.path);
+    EXPECT_EQ(on_disk.root(), tree.root());
+    for (size_t index : {size_t{2}, size_t{3}, size_t{4}, size_t{7}, n / 2, n - 1, n, 2 * n - 1}) {
+        EXPECT_EQ(on_disk.node(index), tree.node(index)) << "node " << index;
+    }
+    for (size_t i : {size_t{0}, n / 3, n - 1}) {
+        std::vector<Digest> path = on_disk.authentication_path(i);
+        EXPECT_TRUE(MerkleTree::verify(on_disk.root(), i, leaves[i], path));
+    }
+}
+
+TEST(MerkleTreeFileTest, ByteLeavesUseHashBytes) {
+    TempPath file("bytes");
+    std::vector<std::string> records = {"alpha", "beta", "gamma", ""};
+    std::vector<Digest> leaves;
+    MerkleTreeFileWriter writer(file.path, records.size());
+    for (const auto& record : records) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(record.data());
+        writer.append_leaf_bytes(data, record.size());
+        leaves.push_back(Tip5Hasher::hash_bytes(data, record.size()));
+    }
+    EXPECT_EQ(writer.leaves_written(), 4u);
+    EXPECT_EQ(writer.finish(), MerkleTree(leaves).root());
+}
+
+TEST(MerkleTreeFileTest, WriterRejectsWrongLeafCounts) {
+    TempPath file("counts");
+    EXPECT_THROW(MerkleTreeFileWriter(file.path, 0), std::invalid_argument);
+    EXPECT_THROW(MerkleTreeFileWriter(file.path, 6), std::invalid_argument);
+
+    MerkleTreeFileWriter writer(file.path, 2);
+    writer.append_leaf(Digest());
+    EXPECT_THROW(writer.finish(), std::logic_error);
+    writer.append_leaf(Digest());
+    EXPECT_THROW(writer.append_leaf(Digest()), std::length_error);
+    writer.finish();
+    EXPECT_THROW(writer.finish(), std::logic_error);
+}
+
+TEST(MerkleTreeFileTest, RejectsIncompleteFiles) {
+    TempPath file("incomplete");
+    EXPECT_THROW(MerkleTreeFile(file.path), std::runtime_error);
+    {
+        // Abandoned writer leaves the header zeroed
+        MerkleTreeFileWriter writer(file.path, 4);
+        writer.append_leaf(Digest());
+    }
+    EXPECT_THROW(MerkleTreeFile(file.path), std::runtime_error);
+
+    RandomGenerator rng(243);
+    write_tree(file.path, rng.random_digests(4), 4);
+    std::ifstream in(file.path, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    {
+        std::ofstream out(file.path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size() - 1));
+    }
+    EXPECT_THROW(MerkleTreeFile(file.path), std::runtime_error);
+}
+
+// Headers claiming a tree whose size overflows 64 bits must not pass the size check
+TEST(MerkleTreeFileTest, RejectsOversizedHeaders) {
+    TempPath file("oversized");
+    for (uint64_t height : {57u, 58u, 62u}) {
+        std::string contents(MerkleTreeFileFormat::DATA_OFFSET, '\0');
+        std::copy(MerkleTreeFileFormat::MAGIC, MerkleTreeFileFormat::MAGIC + 8, contents.begin());
+        auto store = [&](size_t offset, uint64_t value, size_t bytes) {
+            for (size_t i = 0; i < bytes; i++) {
+                contents[offset + i] = static_cast<char>(value >> (8 * i));
+            }
+        };
+        store(8, MerkleTreeFileFormat::VERSION, 4);
+        store(12, MerkleTreeFileFormat::DIGEST_BYTES, 4);
+        store(16, height, 8);
+        store(24, uint64_t{1} << height, 8);
+        store(32, MerkleTreeFileFormat::DATA_OFFSET, 8);
+        {
+            std::ofstream out(file.path, std::ios::binary | std::ios::trunc);
+            out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        }
+        EXPECT_THROW(MerkleTreeFile(file.path), std::runtime_error) << "height " << height;
+    }
+    EXPECT_THROW(MerkleTreeFileWriter(file.path, uint64_t{1} << 57), std::invalid_argument);
+}
+
+TEST(MerkleTreeFileTest, IndexChecksAndMove) {
+    RandomGenerator rng(244);
+    std::vector<Digest> leaves = rng.random_digests(4);
+    TempPath file("move");
+    Digest root = write_tree(file.path, leaves, 4);
+
+    MerkleTreeFile opened(file.path);
+    EXPECT_THROW(opened.node(0), std::out_of_range);
+    EXPECT_THROW(opened.node(8), std::out_of_range);
+    EXPECT_THROW(opened.leaf(4), std::out_of_range);
+    EXPECT_THROW(opened.authentication_path(4), std::out_of_range);
+
+    MerkleTreeFile moved(std::move(opened));
+    EXPECT_EQ(moved.root(), root);
+    EXPECT_EQ(moved.leaf(3), leaves[3]);
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+TEST(MerkleTreeTest, RootOfFourLeavesMatchesManualHashing) {
+    RandomGenerator rng(31);
+    std::vector<Digest> leaves = rng.random_digests(4);
+    MerkleTree tree(leaves);
+
+    Digest left = Tip5Sponge::hash_pair(leaves[0], leaves[1]);
+    Digest right = Tip5Sponge::hash_pair(leaves[2], leaves[3]);
+    EXPECT_EQ(tree.root(), Tip5Sponge::hash_pair(left, right));
+    EXPECT_EQ(tree.height(), 2u);
+    EXPECT_EQ(tree.num_leafs(), 4u);
+    EXPECT_EQ(tree.node(2), left);
+    EXPECT_EQ(tree.leaf(3), leaves[3]);
+}
+
+TEST(MerkleTreeTest, SingleLeafIsRoot) {
+    RandomGenerator rng(32);
+    std::vector<Digest> leaves = rng.random_digests(1);
+    MerkleTree tree(leaves);
+
+    EXPECT_EQ(tree.root(), leaves[0]);
+    EXPECT_TRUE(tree.authentication_path(0).empty());
+    EXPECT_TRUE(MerkleTree::verify(tree.root(), 0, leaves[0], tree.authentication_path(0)));
+}
+
+TEST(MerkleTreeTest, ParallelBuildMatchesSingleThreaded) {
+    RandomGenerator rng(33);
+    std::vector<Digest> leaves = rng.random_digests(1 << 12);
+
+    MerkleTree single(leaves, 1);
+    MerkleTree parallel(leaves, 4);
+    EXPECT_EQ(single.root(), parallel.root());
+}
+
+TEST(MerkleTreeTest, RejectsLeafCountsThatAreNotPowersOfTwo) {
+    std::vector<Digest> leaves(3);
+    EXPECT_THROW(MerkleTree tree(leaves), std::invalid_argument);
+    std::vector<Digest> none;
+    EXPECT_THROW(MerkleTree tree(none), std::invalid_argument);
+}
+
+TEST(MerkleTreeTest, AuthenticationPathsVerify) {
+    RandomGenerator rng(34);
+    std::vector<Digest> leaves = rng.random_digests(64);
+    MerkleTree tree(leaves);
+
+    for (size_t i = 0; i < leaves.size(); i++) {
+        std::vector<Digest> path = tree.authentication_path(i);
+        EXPECT_EQ(path.size(), tree.height());
+        EXPECT_TRUE(MerkleTree::verify(tree.root(), i, leaves[i], path)) << "Failed for leaf " << i;
+        EXPECT_FALSE(MerkleTree::verify(tree.root(), i ^ 1, leaves[i], path));
+        EXPECT_FALSE(MerkleTree::verify(tree.root(), i, leaves[i ^ 1], path));
+    }
+    EXPECT_THROW(tree.authentication_path(64), std::out_of_range);
+}
+
+TEST(MerkleTreeTest, BatchVerification) {
+    RandomGenerator rng(35);
+    std::vector<Digest> leaves = rng.random_digests(32);
+    MerkleTree tree(leaves);
+
+    std::vector<size_t> indices = {0, 1, 5, 17, 31, 5};
+    std::vector<Digest> structure = tree.authentication_structure(indices);
+    std::vector<MerkleTree::IndexedLeaf> revealed;
+    for (size_t i : indices) {
+        revealed.emplace_back(i, leaves[i]);
+    }
+
+    EXPECT_TRUE(MerkleTree::verify_batch(tree.root(), tree.height(), revealed, structure));
+
+    // Shared siblings are sent only once
+    size_t total_path_length = indices.size() * tree.height();
+    EXPECT_LT(structure.size(), total_path_length);
+
+    std::vector<MerkleTree::IndexedLeaf> tampered = revealed;
+    tampered[2].second = leaves[6];
+    EXPECT_FALSE(MerkleTree::verify_batch(tree.root(), tree.height(), tampered, structure));
+
+    std::vector<Digest> short_structure(structure.begin(), structure.end() - 1);
+    EXPECT_FALSE(MerkleTree::verify_batch(tree.root(), tree.height(), revealed, short_structure));
+}
+
+TEST(MerkleTreeTest, AuthenticationStructureOmitsComputableNodes) {
+    // Leaves 0 and 1 of a 4-leaf tree only need node 3
+    std::vector<size_t> indices = {0, 1};
+    EXPECT_EQ(MerkleTree::authentication_structure_node_indices(4, indices), std::vector<size_t>{3});
+
+    indices = {0, 3};
+    EXPECT_EQ(MerkleTree::authentication_structure_node_indices(4, indices), (std::vector<size_t>{6, 5}));
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "tip5xx/executor.hpp"
+#include "tip5xx/ntt.hpp"
+#include "tip5xx/parallel.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+BFieldElement evaluate(const std::vector<BFieldElement>& coefficients, BFieldElement x) {
+    BFieldElement acc = BFieldElement::ZERO;
+    for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+        acc = acc * x + *it;
+    }
+    return acc;
+}
+
+// Compare the transform at a few sampled points against Horner evaluation
+void expect_evaluations(const std::vector<BFieldElement>& coefficients,
+                        const std::vector<BFieldElement>& evaluations,
+                        BFieldElement offset, RandomGenerator& rng) {
+    size_t n = coefficients.size();
+    BFieldElement omega = BFieldElement::primitive_root_of_unity(n);
+    std::vector<size_t> indices = {0, 1, n - 1};
+    for (int i = 0; i < 5; i++) {
+        indices.push_back(rng.random_range<size_t>(n - 1));
+    }
+    for (size_t i : indices) {
+        EXPECT_EQ(evaluations[i], evaluate(coefficients, offset * omega.mod_pow(i))) << "n = " << n << ", i = " << i;
+    }
+}
+
+} // namespace
+
+TEST(NttTest, MatchesNaiveEvaluationForSmallSizes) {
+    RandomGenerator rng(51);
+    for (size_t log_n = 0; log_n <= 8; log_n++) {
+        size_t n = size_t{1} << log_n;
+        std::vector<BFieldElement> coefficients = rng.random_elements(n);
+        std::vector<BFieldElement> values = coefficients;
+        Ntt::forward(values);
+
+        BFieldElement omega = BFieldElement::primitive_root_of_unity(n);
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(values[i], evaluate(coefficients, omega.mod_pow(i))) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST(NttTest, InverseUndoesForward) {
+    RandomGenerator rng(52);
+    for (size_t log_n : {0, 1, 2, 5, 10, 13}) {
+        std::vector<BFieldElement> original = rng.random_elements(size_t{1} << log_n);
+        std::vector<BFieldElement> values = original;
+        Ntt::forward(values);
+        Ntt::inverse(values);
+        EXPECT_EQ(values, original) << "log_n = " << log_n;
+    }
+}
+
+TEST(NttTest, FourStepMatchesEvaluation) {
+    RandomGenerator rng(53);
+    size_t n = size_t{1} << Ntt::FOUR_STEP_LOG2_THRESHOLD;
+    std::vector<BFieldElement> coefficients = rng.random_elements(n);
+    std::vector<BFieldElement> values = coefficients;
+
+    Ntt::forward(values);
+    expect_evaluations(coefficients, values, BFieldElement::ONE, rng);
+
+    Ntt::inverse(values);
+    EXPECT_EQ(values, coefficients);
+}
+
+TEST(NttTest, OddLog2FourStepMatchesEvaluation) {
+    RandomGenerator rng(54);
+    size_t n = size_t{1} << (Ntt::FOUR_STEP_LOG2_THRESHOLD + 1);
+    std::vector<BFieldElement> coefficients = rng.random_elements(n);
+    std::vector<BFieldElement> values = coefficients;
+
+    Ntt::forward(values, 1);
+    expect_evaluations(coefficients, values, BFieldElement::ONE, rng);
+}
+
+TEST(NttTest, MultithreadedMatchesSingleThreaded) {
+    RandomGenerator rng(55);
+    std::vector<BFieldElement> coefficients = rng.random_elements(Ntt::PARALLEL_THRESHOLD);
+    std::vector<BFieldElement> sequential = coefficients;
+    std::vector<BFieldElement> threaded = coefficients;
+
+    Ntt::forward(sequential, 1);
+    Ntt::forward(threaded, 4);
+    EXPECT_EQ(threaded, sequential);
+    expect_evaluations(coefficients, threaded, BFieldElement::ONE, rng);
+
+    Ntt::inverse(threaded, 4);
+    EXPECT_EQ(threaded, coefficients);
+}
+
+TEST(NttTest, CosetTransformEvaluatesOnCoset) {
+    RandomGenerator rng(56);
+    BFieldElement offset = BFieldElement::generator();
+    std::vector<BFieldElement> coefficients = rng.random_elements(64);
+    std::vector<BFieldElement> values = coefficients;
+
+    Ntt::coset_forward(values, offset);
+    expect_evaluations(coefficients, values, offset, rng);
+
+    Ntt::coset_inverse(values, offset);
+    EXPECT_EQ(values, coefficients);
+}
+
+TEST(NttTest, LowDegreeExtensionEvaluatesSamePolynomial) {
+    RandomGenerator rng(57);
+    BFieldElement offset = BFieldElement::generator();
+    std::vector<BFieldElement> coefficients = rng.random_elements(32);
+    std::vector<BFieldElement> evaluations = coefficients;
+    Ntt::forward(evaluations);
+
+    std::vector<BFieldElement> extended = Ntt::low_degree_extension(evaluations, 4, offset);
+    ASSERT_EQ(extended.size(), 128u);
+
+    std::vector<BFieldElement> padded = coefficients;
+    padded.resize(128, BFieldElement::ZERO);
+    expect_evaluations(padded, extended, offset, rng);
+}
+
+TEST(NttTest, LowDegreeExtensionIntoCallerStorage) {
+    RandomGenerator rng(58);
+    BFieldElement offset = BFieldElement::generator();
+    std::vector<BFieldElement> evaluations = rng.random_elements(64);
+
+    std::vector<BFieldElement> out(256, BFieldElement::ONE);
+    Ntt::low_degree_extension(evaluations, out, offset);
+    EXPECT_EQ(out, Ntt::low_degree_extension(evaluations, 4, offset));
+
+    std::vector<BFieldElement> uneven(100);
+    EXPECT_THROW(Ntt::low_degree_extension(evaluations, uneven, offset), std::invalid_argument);
+}
+
+// A first use that builds the twiddle table on the executor must not wait on
+// executor tasks that themselves wait for the same table
+TEST(NttTest, ConcurrentFirstUseFromExecutorTasks) {
+    set_default_executor(std::make_shared<WorkStealingExecutor>(4));
+    for (size_t log_n : {17u, 19u}) {
+        size_t n = size_t{1} << log_n;
+        std::vector<BFieldElement> expected(n, BFieldElement::ONE);
+        std::thread outside([&] { Ntt::forward(expected); });
+        std::vector<std::vector<BFieldElement>> inside(4, std::vector<BFieldElement>(n, BFieldElement::ONE));
+        parallel_for(inside.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Ntt::forward(inside[i], 1);
+            }
+        });
+        outside.join();
+        for (const auto& values : inside) {
+            EXPECT_EQ(values, expected) << "n = " << n;
+        }
+    }
+    set_default_executor(nullptr);
+}
+
+TEST(NttTest, RejectsInvalidSizes) {
+    std::vector<BFieldElement> empty;
+    std::vector<BFieldElement> three(3);
+    EXPECT_THROW(Ntt::forward(empty), std::invalid_argument);
+    EXPECT_THROW(Ntt::inverse(three), std::invalid_argument);
+
+    std::vector<BFieldElement> four(4);
+    EXPECT_THROW(Ntt::low_degree_extension(four, 3, BFieldElement::ONE), std::invalid_argument);
+}
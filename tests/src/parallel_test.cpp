@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/parallel.hpp"
+
+using namespace tip5xx;
+
+TEST(ParallelTest, ParallelForCoversRangeExactlyOnce) {
+    std::vector<std::atomic<int>> visits(10007);
+    parallel_for(visits.size(), 100, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    }, 8);
+
+    for (size_t i = 0; i < visits.size(); i++) {
+        EXPECT_EQ(visits[i].load(), 1) << "Index " << i;
+    }
+}
+
+TEST(ParallelTest, ParallelForRunsSmallInputsInline) {
+    size_t calls = 0;
+    parallel_for(10, 100, [&](size_t begin, size_t end) {
+        calls++;
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u);
+    }, 8);
+    EXPECT_EQ(calls, 1u);
+
+    parallel_for(0, 1, [&](size_t, size_t) { calls++; });
+    EXPECT_EQ(calls, 1u);
+}
+
+TEST(ParallelTest, ParallelForPropagatesExceptions) {
+    EXPECT_THROW(parallel_for(1000, 1, [](size_t begin, size_t) {
+        if (begin == 0) {
+            throw std::runtime_error("chunk failed");
+        }
+    }, 4), std::runtime_error);
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "tip5xx/ntt.hpp"
+#include "tip5xx/polynomial.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+using BPolynomial = Polynomial<BFieldElement>;
+
+namespace {
+
+BPolynomial random_polynomial(RandomGenerator& rng, size_t num_coefficients) {
+    std::vector<BFieldElement> c = rng.random_elements(num_coefficients);
+    if (!c.empty() && c.back().is_zero()) {
+        c.back() = BFieldElement::ONE;
+    }
+    return BPolynomial(c);
+}
+
+} // namespace
+
+TEST(PolynomialTest, NormalizesCoefficients) {
+    BPolynomial p(std::vector<BFieldElement>{BFieldElement::new_element(1), BFieldElement::ZERO,
+                                             BFieldElement::new_element(3), BFieldElement::ZERO});
+    EXPECT_EQ(p.degree(), 2);
+    EXPECT_EQ(p.coefficients().size(), 3u);
+    EXPECT_EQ(p.to_string(), "3·x^2 + 1");
+    EXPECT_EQ(p.leading_coefficient(), BFieldElement::new_element(3));
+
+    EXPECT_TRUE(BPolynomial().is_zero());
+    EXPECT_EQ(BPolynomial().degree(), -1);
+    EXPECT_EQ((p - p), BPolynomial());
+    EXPECT_EQ(BPolynomial().to_string(), "0");
+    EXPECT_EQ(BPolynomial::x_to_the(3).degree(), 3);
+}
+
+TEST(PolynomialTest, MultiplicationAlgorithmsAgree) {
+    RandomGenerator rng(281);
+    std::vector<std::pair<size_t, size_t>> sizes = {{1, 1}, {5, 300}, {33, 40}, {100, 100},
+                                                    {64, 200}, {513, 700}, {0, 10}};
+    for (const auto& size : sizes) {
+        BPolynomial a = random_polynomial(rng, size.first);
+        BPolynomial b = random_polynomial(rng, size.second);
+        BPolynomial expected = BPolynomial::naive_multiply(a, b);
+        EXPECT_EQ(BPolynomial::karatsuba_multiply(a, b), expected) << size.first << " x " << size.second;
+        EXPECT_EQ(BPolynomial::ntt_multiply(a, b), expected) << size.first << " x " << size.second;
+        EXPECT_EQ(a * b, expected) << size.first << " x " << size.second;
+    }
+
+    BPolynomial p = random_polynomial(rng, 10);
+    BFieldElement x = rng.random_bfe();
+    BFieldElement s = rng.random_bfe();
+    EXPECT_EQ((p * p).evaluate(x), p.evaluate(x) * p.evaluate(x));
+    EXPECT_EQ((p * s).evaluate(x), p.evaluate(x) * s);
+    EXPECT_EQ(p.scale(s).evaluate(x), p.evaluate(s * x));
+}
+
+TEST(PolynomialTest, DivisionRecoversQuotientAndRemainder) {
+    RandomGenerator rng(282);
+    std::vector<std::pair<size_t, size_t>> sizes = {{1, 1}, {10, 3}, {300, 100}, {1000, 200}, {700, 650}};
+    for (const auto& size : sizes) {
+        BPolynomial divisor = random_polynomial(rng, size.second);
+        BPolynomial quotient = random_polynomial(rng, size.first);
+        BPolynomial remainder = random_polynomial(rng, size.second - 1);
+        BPolynomial dividend = quotient * divisor + remainder;
+
+        auto result = dividend.divide(divisor);
+        EXPECT_EQ(result.first, quotient) << size.first << " / " << size.second;
+        EXPECT_EQ(result.second, remainder) << size.first << " / " << size.second;
+    }
+
+    BPolynomial small = random_polynomial(rng, 3);
+    BPolynomial large = random_polynomial(rng, 8);
+    EXPECT_EQ(small / large, BPolynomial());
+    EXPECT_EQ(small % large, small);
+    EXPECT_THROW(small.divide(BPolynomial()), std::invalid_argument);
+}
+
+TEST(PolynomialTest, BatchEvaluateMatchesHorner) {
+    RandomGenerator rng(283);
+    for (size_t degree : {size_t{0}, size_t{5}, size_t{150}, size_t{600}}) {
+        BPolynomial p = random_polynomial(rng, degree + 1);
+        std::vector<BFieldElement> xs = rng.random_elements(300);
+        std::vector<BFieldElement> values = p.batch_evaluate(xs);
+        ASSERT_EQ(values.size(), xs.size());
+        for (size_t i = 0; i < xs.size(); i++) {
+            EXPECT_EQ(values[i], p.evaluate(xs[i])) << "degree " << degree << ", point " << i;
+        }
+    }
+    EXPECT_EQ(BPolynomial().batch_evaluate(std::vector<BFieldElement>(3)), std::vector<BFieldElement>(3));
+}
+
+TEST(PolynomialTest, InterpolationAndZerofier) {
+    RandomGenerator rng(284);
+    for (size_t n : {size_t{1}, size_t{7}, size_t{33}, size_t{257}}) {
+        std::vector<BFieldElement> xs = rng.random_elements(n);
+        std::vector<BFieldElement> ys = rng.random_elements(n);
+        BPolynomial p = BPolynomial::interpolate(xs, ys);
+        EXPECT_LT(p.degree(), static_cast<int64_t>(n));
+        EXPECT_EQ(p.batch_evaluate(xs), ys) << "n = " << n;
+
+        BPolynomial zerofier = BPolynomial::zerofier(xs);
+        EXPECT_EQ(zerofier.degree(), static_cast<int64_t>(n));
+        EXPECT_EQ(zerofier.leading_coefficient(), BFieldElement::ONE);
+        EXPECT_EQ(zerofier.batch_evaluate(xs), std::vector<BFieldElement>(n, BFieldElement::ZERO));
+    }
+
+    BPolynomial cubic = random_polynomial(rng, 4);
+    std::vector<BFieldElement> xs = rng.random_elements(10);
+    EXPECT_EQ(BPolynomial::interpolate(xs, cubic.batch_evaluate(xs)), cubic);
+
+    xs[3] = xs[7];
+    EXPECT_THROW(BPolynomial::interpolate(xs, xs), std::invalid_argument);
+    EXPECT_THROW(BPolynomial::interpolate(xs, std::vector<BFieldElement>(9)), std::invalid_argument);
+    EXPECT_EQ(BPolynomial::interpolate({}, {}), BPolynomial());
+}
+
+TEST(PolynomialTest, BarycentricEvaluation) {
+    RandomGenerator rng(285);
+    for (size_t n : {size_t{1}, size_t{2}, size_t{64}, size_t{1024}}) {
+        BPolynomial p = random_polynomial(rng, n);
+        std::vector<BFieldElement> codeword = p.coefficients();
+        codeword.resize(n, BFieldElement::ZERO);
+        Ntt::forward(codeword);
+
+        BFieldElement x = rng.random_bfe();
+        EXPECT_EQ(BPolynomial::barycentric_evaluate(codeword, x), p.evaluate(x)) << "n = " << n;
+        BFieldElement in_domain = BFieldElement::primitive_root_of_unity(n).mod_pow(n / 2);
+        EXPECT_EQ(BPolynomial::barycentric_evaluate(codeword, in_domain), codeword[n / 2]);
+    }
+    EXPECT_THROW(BPolynomial::barycentric_evaluate(std::vector<BFieldElement>(3), BFieldElement::ONE),
+                 std::invalid_argument);
+    EXPECT_THROW(BPolynomial::barycentric_evaluate({}, BFieldElement::ONE), std::invalid_argument);
+}
+
+TEST(PolynomialTest, FormalDerivative) {
+    // 2 + 3x + 5x^3 -> 3 + 15x^2
+    BPolynomial p(std::vector<BFieldElement>{BFieldElement::new_element(2), BFieldElement::new_element(3),
+                                             BFieldElement::ZERO, BFieldElement::new_element(5)});
+    BPolynomial expected(std::vector<BFieldElement>{BFieldElement::new_element(3), BFieldElement::ZERO,
+                                                    BFieldElement::new_element(15)});
+    EXPECT_EQ(p.formal_derivative(), expected);
+    EXPECT_EQ(BPolynomial::constant(BFieldElement::ONE).formal_derivative(), BPolynomial());
+}
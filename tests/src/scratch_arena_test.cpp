@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <utility>
+#include "tip5xx/b_field_element.hpp"
+#include "tip5xx/scratch_arena.hpp"
+
+using namespace tip5xx;
+
+TEST(ScratchArenaTest, ReturnedBuffersAreReused) {
+    ScratchArena arena;
+    void* first = nullptr;
+    {
+        auto lease = arena.borrow<BFieldElement>(1000);
+        ASSERT_EQ(lease.size(), 1000u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(lease.data()) % ScratchArena::ALIGNMENT, 0u);
+        lease[999] = BFieldElement::ONE;
+        first = lease.data();
+    }
+    // 1000 elements round up to an 8 KiB size class
+    EXPECT_EQ(arena.cached_bytes(), 8192u);
+
+    auto again = arena.borrow<uint64_t>(900);
+    EXPECT_EQ(static_cast<void*>(again.data()), first);
+    EXPECT_EQ(arena.cached_bytes(), 0u);
+}
+
+TEST(ScratchArenaTest, LargeBuffersAreMappedAndTrimmed) {
+    ScratchArena arena;
+    {
+        auto lease = arena.borrow<uint64_t>(ScratchArena::HUGE_PAGE_SIZE / sizeof(uint64_t) + 1);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(lease.data()) % ScratchArena::ALIGNMENT, 0u);
+        lease[lease.size() - 1] = 7;
+        lease[0] = 3;
+
+        auto moved = std::move(lease);
+        EXPECT_EQ(lease.data(), nullptr);
+        EXPECT_EQ(moved[0], 3u);
+        EXPECT_EQ(arena.cached_bytes(), 0u);
+    }
+    EXPECT_EQ(arena.cached_bytes(), 2 * ScratchArena::HUGE_PAGE_SIZE);
+    arena.trim();
+    EXPECT_EQ(arena.cached_bytes(), 0u);
+}
+
+TEST(ScratchArenaTest, CacheLimitReleasesExcessBuffers) {
+    ScratchArena arena(4096);
+    {
+        auto a = arena.borrow<uint8_t>(4096);
+        auto b = arena.borrow<uint8_t>(4096);
+        auto empty = arena.borrow<uint8_t>(0);
+        EXPECT_EQ(empty.data(), nullptr);
+    }
+    EXPECT_EQ(arena.cached_bytes(), 4096u);
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/serialization.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+TEST(SerializationTest, BytesMatchPerElementEncoding) {
+    RandomGenerator rng(221);
+    std::vector<BFieldElement> values = rng.random_elements(1000);
+    values[3] = BFieldElement::new_element(BFieldElement::MAX);
+
+    std::vector<uint8_t> bytes(values.size() * BFieldElement::BYTES);
+    encode_bytes(values, bytes);
+    for (size_t i = 0; i < values.size(); i++) {
+        std::array<uint8_t, 8> expected = values[i].raw_bytes();
+        ASSERT_EQ(std::memcmp(bytes.data() + 8 * i, expected.data(), 8), 0) << "Failed at index " << i;
+    }
+
+    std::vector<BFieldElement> decoded(values.size());
+    DecodeStatus status = decode_bytes(bytes, decoded);
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ(decoded, values);
+}
+
+TEST(SerializationTest, U16sMatchPerElementEncoding) {
+    RandomGenerator rng(222);
+    std::vector<BFieldElement> values = rng.random_elements(300);
+
+    std::vector<uint16_t> chunks(values.size() * 4);
+    encode_u16s(values, chunks);
+    for (size_t i = 0; i < values.size(); i++) {
+        std::array<uint16_t, 4> expected = values[i].raw_u16s();
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), chunks.begin() + 4 * i)) << "Failed at index " << i;
+    }
+
+    std::vector<BFieldElement> decoded(values.size());
+    EXPECT_TRUE(decode_u16s(chunks, decoded));
+    EXPECT_EQ(decoded, values);
+}
+
+TEST(SerializationTest, DecodeReportsFirstNonCanonicalElement) {
+    RandomGenerator rng(223);
+    std::vector<BFieldElement> values = rng.random_elements(600);
+    std::vector<uint8_t> bytes(values.size() * BFieldElement::BYTES);
+    encode_bytes(values, bytes);
+
+    // P itself at element 300 and 0xFF..FF at element 450
+    const uint64_t p = BFieldElement::P;
+    for (size_t j = 0; j < 8; j++) {
+        bytes[8 * 300 + j] = static_cast<uint8_t>(p >> (8 * j));
+        bytes[8 * 450 + j] = 0xFF;
+    }
+
+    std::vector<BFieldElement> decoded(values.size());
+    DecodeStatus status = decode_bytes(bytes, decoded);
+    EXPECT_FALSE(status);
+    EXPECT_EQ(status.error_index, 300u);
+    EXPECT_TRUE(std::equal(values.begin(), values.begin() + 300, decoded.begin()));
+
+    std::vector<uint16_t> chunks(4, 0xFFFF);
+    std::vector<BFieldElement> one(1);
+    EXPECT_EQ(decode_u16s(chunks, one).error_index, 0u);
+}
+
+TEST(SerializationTest, RejectsMismatchedLengths) {
+    std::vector<BFieldElement> values(4);
+    std::vector<uint8_t> bytes(31);
+    std::vector<uint16_t> chunks(15);
+    EXPECT_THROW(encode_bytes(values, bytes), std::invalid_argument);
+    EXPECT_THROW(decode_bytes(bytes, values), std::invalid_argument);
+    EXPECT_THROW(encode_u16s(values, chunks), std::invalid_argument);
+    EXPECT_THROW(decode_u16s(chunks, values), std::invalid_argument);
+}
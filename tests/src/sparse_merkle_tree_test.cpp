@@ -0,0 +1,237 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "tip5xx/merkle_tree.hpp"
+#include "tip5xx/sparse_merkle_tree.hpp"
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+TEST(SparseMerkleTreeTest, EmptyTreeHasDefaultRoot) {
+    SparseMerkleTree tree(3);
+    std::vector<Digest> leaves(8);
+    EXPECT_EQ(tree.root(), MerkleTree(leaves).root());
+    EXPECT_EQ(tree.root(), tree.default_digest(3));
+    EXPECT_EQ(tree.get(5), Digest());
+    EXPECT_EQ(tree.arena_size(), 0u);
+    EXPECT_THROW(SparseMerkleTree(65), std::invalid_argument);
+}
+
+TEST(SparseMerkleTreeTest, DenseWritesMatchMerkleTree) {
+    RandomGenerator rng(191);
+    std::vector<Digest> leaves(16);
+    std::vector<SparseMerkleTree::Write> writes;
+    for (size_t i = 0; i < leaves.size(); i++) {
+        leaves[i] = rng.random_digest();
+        writes.emplace_back(i, leaves[i]);
+    }
+
+    SparseMerkleTree batched(4);
+    batched.update(writes);
+    EXPECT_EQ(batched.root(), MerkleTree(leaves).root());
+    // 16 leaves and 15 inner nodes, each allocated and hashed once
+    EXPECT_EQ(batched.arena_size(), 31u);
+    EXPECT_EQ(batched.live_nodes(), 31u);
+
+    SparseMerkleTree single(4);
+    for (const auto& write : writes) {
+        single.set(write.first, write.second);
+    }
+    EXPECT_EQ(single.root(), batched.root());
+
+    leaves[9] = rng.random_digest();
+    batched.set(9, leaves[9]);
+    EXPECT_EQ(batched.root(), MerkleTree(leaves).root());
+    EXPECT_EQ(batched.arena_size(), 31u + 5u);
+    EXPECT_EQ(batched.live_nodes(), 31u);
+}
+
+TEST(SparseMerkleTreeTest, LaterWritesToTheSameKeyWin) {
+    RandomGenerator rng(192);
+    Digest first = rng.random_digest();
+    Digest second = rng.random_digest();
+    std::vector<SparseMerkleTree::Write> writes = {{7, first}, {3, first}, {7, second}};
+
+    SparseMerkleTree tree(8);
+    tree.update(writes);
+    EXPECT_EQ(tree.get(7), second);
+    EXPECT_EQ(tree.get(3), first);
+
+    SparseMerkleTree expected(8);
+    expected.set(3, first);
+    expected.set(7, second);
+    EXPECT_EQ(tree.root(), expected.root());
+}
+
+TEST(SparseMerkleTreeTest, CopiesAreIndependentSnapshots) {
+    RandomGenerator rng(193);
+    SparseMerkleTree tree;
+    tree.set(42, rng.random_digest());
+    SparseMerkleTree snapshot = tree;
+    Digest snapshot_root = snapshot.root();
+
+    tree.set(42, rng.random_digest());
+    tree.set(std::numeric_limits<uint64_t>::max(), rng.random_digest());
+    EXPECT_NE(tree.root(), snapshot_root);
+    EXPECT_EQ(snapshot.root(), snapshot_root);
+    EXPECT_EQ(snapshot.get(std::numeric_limits<uint64_t>::max()), Digest());
+}
+
+TEST(SparseMerkleTreeTest, AuthenticationPathsVerifyInFullKeySpace) {
+    RandomGenerator rng(194);
+    SparseMerkleTree tree;
+    std::vector<SparseMerkleTree::Write> writes;
+    for (int i = 0; i < 50; i++) {
+        writes.emplace_back(rng.engine()(), rng.random_digest());
+    }
+    writes.emplace_back(0, rng.random_digest());
+    writes.emplace_back(std::numeric_limits<uint64_t>::max(), rng.random_digest());
+    tree.update(writes);
+
+    for (const auto& write : writes) {
+        EXPECT_EQ(tree.get(write.first), write.second);
+        std::vector<Digest> path = tree.authentication_path(write.first);
+        ASSERT_EQ(path.size(), SparseMerkleTree::MAX_HEIGHT);
+        EXPECT_TRUE(SparseMerkleTree::verify(tree.root(), tree.height(), write.first, write.second, path));
+        EXPECT_FALSE(SparseMerkleTree::verify(tree.root(), tree.height(), write.first ^ 1, write.second, path));
+    }
+
+    // Non-membership: an unwritten key proves the default leaf
+    std::vector<Digest> path = tree.authentication_path(12345);
+    EXPECT_TRUE(SparseMerkleTree::verify(tree.root(), tree.height(), 12345, Digest(), path));
+}
+
+TEST(SparseMerkleTreeTest, ResettingLeavesRestoresDefaultsAndCompacts) {
+    RandomGenerator rng(195);
+    SparseMerkleTree tree(16);
+    Digest empty_root = tree.root();
+    tree.set(1, rng.random_digest());
+    tree.set(1000, rng.random_digest());
+    tree.set(1, Digest());
+    EXPECT_NE(tree.root(), empty_root);
+    tree.set(1000, Digest());
+    EXPECT_EQ(tree.root(), empty_root);
+
+    SparseMerkleTree kept(16);
+    kept.set(2, rng.random_digest());
+    Digest root = kept.root();
+    for (int i = 0; i < 10; i++) {
+        kept.set(3, rng.random_digest());
+    }
+    kept.set(3, Digest());
+    EXPECT_GT(kept.arena_size(), 17u);
+    EXPECT_EQ(kept.live_nodes(), 17u);
+    kept.compact();
+    EXPECT_EQ(kept.arena_size(), 17u);
+    EXPECT_EQ(kept.root(), root);
+}
+
+TEST(SparseMerkleTreeTest, UpdatesCompactOnceMostNodesAreGarbage) {
+    RandomGenerator rng(196);
+    SparseMerkleTree tree(16);
+    std::vector<SparseMerkleTree::Write> writes;
+    for (int i = 0; i < 100; i++) {
+        writes.emplace_back(rng.random_range<uint64_t>(0xffff), rng.random_digest());
+    }
+    tree.update(writes);
+    size_t live_nodes = tree.live_nodes();
+
+    // Each overwrite replaces a path of 17 nodes
+    Digest leaf;
+    for (size_t i = 0; i < 2 * SparseMerkleTree::AUTO_COMPACT_MIN_NODES / 17; i++) {
+        leaf = rng.random_digest();
+        tree.set(writes[0].first, leaf);
+        ASSERT_LT(tree.arena_size(), SparseMerkleTree::AUTO_COMPACT_MIN_NODES + 17);
+    }
+    EXPECT_EQ(tree.live_nodes(), live_nodes);
+    EXPECT_EQ(tree.get(writes[0].first), leaf);
+}
+
+// Snapshots keep the old nodes alive, so compacting would only duplicate the
+// live tree; the arena stays shared until the snapshots are dropped
+TEST(SparseMerkleTreeTest, SharedArenasAreNotAutoCompacted) {
+    RandomGenerator rng(198);
+    SparseMerkleTree tree(32);
+    SparseMerkleTree::Key key = rng.random_range<uint64_t>(0xffffffff);
+    std::vector<SparseMerkleTree> snapshots;
+    std::vector<Digest> roots;
+
+    // Each overwrite replaces a path of 33 nodes
+    for (size_t i = 0; i < 2 * SparseMerkleTree::AUTO_COMPACT_MIN_NODES / 33; i++) {
+        tree.set(key, rng.random_digest());
+        snapshots.push_back(tree);
+        roots.push_back(tree.root());
+    }
+    ASSERT_GT(tree.arena_size(), SparseMerkleTree::AUTO_COMPACT_MIN_NODES);
+    for (size_t i = 0; i < snapshots.size(); i++) {
+        EXPECT_EQ(snapshots[i].arena_size(), tree.arena_size());
+        EXPECT_EQ(snapshots[i].root(), roots[i]);
+    }
+
+    snapshots.clear();
+    Digest leaf = rng.random_digest();
+    tree.set(key, leaf);
+    EXPECT_EQ(tree.arena_size(), tree.live_nodes());
+    EXPECT_EQ(tree.get(key), leaf);
+}
+
+// Growing the shared arena must not move nodes a reader of another copy is using
+TEST(SparseMerkleTreeTest, CopiesCanBeReadWhileAnotherIsUpdated) {
+    RandomGenerator rng(197);
+    SparseMerkleTree tree;
+    std::vector<SparseMerkleTree::Write> writes;
+    for (int i = 0; i < 64; i++) {
+        writes.emplace_back(rng.engine()(), rng.random_digest());
+    }
+    tree.update(writes);
+    const SparseMerkleTree snapshot = tree;
+    const Digest root = snapshot.root();
+
+    std::thread reader([&] {
+        for (int round = 0; round < 5; round++) {
+            for (const auto& write : writes) {
+                EXPECT_EQ(snapshot.get(write.first), write.second);
+                std::vector<Digest> path = snapshot.authentication_path(write.first);
+                EXPECT_TRUE(SparseMerkleTree::verify(root, snapshot.height(), write.first, write.second, path));
+            }
+        }
+    });
+    for (int i = 0; i < 100; i++) {
+        tree.set(rng.engine()(), rng.random_digest());
+    }
+    reader.join();
+    EXPECT_EQ(snapshot.root(), root);
+}
+
+TEST(SparseMerkleTreeTest, RejectsKeysOutsideTheTree) {
+    SparseMerkleTree tree(4);
+    EXPECT_THROW(tree.set(16, Digest()), std::out_of_range);
+    std::vector<SparseMerkleTree::Write> writes = {{1, Digest()}, {99, Digest()}};
+    EXPECT_THROW(tree.update(writes), std::out_of_range);
+    EXPECT_THROW(tree.authentication_path(16), std::out_of_range);
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/tip5_hasher.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+std::vector<uint8_t> random_bytes(RandomGenerator& rng, size_t n) {
+    std::vector<uint8_t> bytes(n);
+    for (auto& b : bytes) {
+        b = static_cast<uint8_t>(rng.random_range<uint32_t>(255));
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(Tip5HasherTest, ElementsOnlyMatchHashVarlen) {
+    RandomGenerator rng(21);
+    for (size_t n : {0u, 1u, 9u, 10u, 11u, 100u}) {
+        std::vector<BFieldElement> input = rng.random_elements(n);
+
+        Tip5Hasher hasher;
+        hasher.update(input);
+        EXPECT_EQ(hasher.finalize(), Tip5Sponge::hash_varlen(input)) << "Failed for length " << n;
+    }
+}
+
+TEST(Tip5HasherTest, ChunkingDoesNotChangeDigest) {
+    RandomGenerator rng(22);
+    std::vector<uint8_t> data = random_bytes(rng, 1000);
+    Digest expected = Tip5Hasher::hash_bytes(data.data(), data.size());
+
+    for (int iteration = 0; iteration < 20; iteration++) {
+        Tip5Hasher hasher(Tip5Hasher::Input::Bytes);
+        size_t offset = 0;
+        while (offset < data.size()) {
+            size_t chunk = std::min(data.size() - offset, rng.random_range<size_t>(0, 50));
+            hasher.update(data.data() + offset, chunk);
+            offset += chunk;
+        }
+        EXPECT_EQ(hasher.finalize(), expected) << "Failed on iteration " << iteration;
+    }
+}
+
+TEST(Tip5HasherTest, ByteEncodingIsUnambiguous) {
+    const uint8_t abc[] = {'a', 'b', 'c'};
+    const uint8_t abc0[] = {'a', 'b', 'c', 0};
+
+    EXPECT_NE(Tip5Hasher::hash_bytes(abc, 3), Tip5Hasher::hash_bytes(abc0, 4));
+    EXPECT_NE(Tip5Hasher::hash_bytes(nullptr, 0), Tip5Hasher::hash_bytes(abc0 + 3, 1));
+}
+
+TEST(Tip5HasherTest, BytesAreDomainSeparatedFromElements) {
+    const uint8_t a[] = {'a'};
+    const std::vector<BFieldElement> packed{bfe(0x0161)};
+    EXPECT_NE(Tip5Hasher::hash_bytes(a, 1), Tip5Sponge::hash_varlen(packed));
+    EXPECT_NE(Tip5Hasher::hash_bytes(nullptr, 0), Tip5Sponge::hash_varlen({}));
+
+    // Each hasher accepts only the kind of input it was constructed for
+    Tip5Hasher elements;
+    EXPECT_THROW(elements.update(a, 1), std::logic_error);
+    Tip5Hasher bytes(Tip5Hasher::Input::Bytes);
+    EXPECT_THROW(bytes.update(packed), std::logic_error);
+    EXPECT_EQ(bytes.finalize(), Tip5Hasher::hash_bytes(nullptr, 0));
+}
+
+TEST(Tip5HasherTest, FinalizeResetsHasher) {
+    const uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    Tip5Hasher hasher(Tip5Hasher::Input::Bytes);
+    hasher.update(data, sizeof(data));
+    EXPECT_EQ(hasher.absorbed_elements(), 1u);
+    Digest first = hasher.finalize();
+
+    EXPECT_EQ(hasher.absorbed_elements(), 0u);
+    hasher.update(data, sizeof(data));
+    EXPECT_EQ(hasher.finalize(), first);
+}
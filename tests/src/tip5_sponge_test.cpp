@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <set>
+#include "tip5xx/tip5_sponge.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+// Test vector from twenty_first::math::tip5
+TEST(Tip5SpongeTest, Hash10TestVectors) {
+    Tip5Sponge::RateBlock preimage;
+    preimage.fill(BFieldElement::ZERO);
+    Digest digest;
+    for (size_t i = 0; i < 6; i++) {
+        digest = Tip5Sponge::hash_10(preimage);
+        std::copy(digest.values().begin(), digest.values().end(), preimage.begin() + i);
+    }
+    digest = Tip5Sponge::hash_10(preimage);
+
+    Digest expected(Digest::Values{
+        bfe(10869784347448351760ULL),
+        bfe(1853783032222938415ULL),
+        bfe(6856460589287344822ULL),
+        bfe(17178399545409290325ULL),
+        bfe(7650660984651717733ULL)
+    });
+    EXPECT_EQ(digest, expected);
+}
+
+// The tables are constant expressions in every translation unit
+static_assert(Tip5Sponge::LOOKUP_TABLE[2] == 26, "LOOKUP_TABLE must be usable at compile time");
+static_assert(Tip5Sponge::MDS_MATRIX_FIRST_COLUMN[0] == 61402, "MDS_MATRIX_FIRST_COLUMN must be usable at compile time");
+static_assert(Tip5Sponge::ROUND_CONSTANTS[1].value() == 16896927574093233874ULL,
+              "ROUND_CONSTANTS must be usable at compile time");
+
+TEST(Tip5SpongeTest, LookupTableIsCubingInFieldOf257) {
+    std::set<uint8_t> seen;
+    for (uint32_t x = 0; x < 256; x++) {
+        uint32_t cube = ((x + 1) * (x + 1) * (x + 1)) % 257;
+        EXPECT_EQ(static_cast<uint32_t>(Tip5Sponge::LOOKUP_TABLE[x]), cube - 1) << "Failed for " << x;
+        seen.insert(Tip5Sponge::LOOKUP_TABLE[x]);
+    }
+    // The lookup table must be a permutation of the bytes
+    EXPECT_EQ(seen.size(), 256u);
+}
+
+TEST(Tip5SpongeTest, RoundConstantsAreCanonical) {
+    for (const auto& c : Tip5Sponge::ROUND_CONSTANTS) {
+        EXPECT_TRUE(BFieldElement::is_canonical(c.raw_u64()));
+    }
+}
+
+TEST(Tip5SpongeTest, SplitAndLookupPreservesZeroAndStaysInField) {
+    BFieldElement zero = BFieldElement::ZERO;
+    Tip5Sponge::split_and_lookup(zero);
+    EXPECT_EQ(zero, BFieldElement::ZERO);
+
+    RandomGenerator rng(42);
+    for (int i = 0; i < 1000; i++) {
+        BFieldElement e = rng.random_bfe();
+        Tip5Sponge::split_and_lookup(e);
+        EXPECT_TRUE(BFieldElement::is_canonical(e.raw_u64()));
+    }
+}
+
+TEST(Tip5SpongeTest, MdsMatchesNaiveCirculantProduct) {
+    RandomGenerator rng(7);
+    for (int iteration = 0; iteration < 20; iteration++) {
+        Tip5Sponge sponge(Domain::VariableLength);
+        for (auto& e : sponge.state()) {
+            e = rng.random_bfe();
+        }
+        Tip5Sponge::State input = sponge.state();
+
+        Tip5Sponge::State expected;
+        for (size_t i = 0; i < Tip5Sponge::STATE_SIZE; i++) {
+            BFieldElement acc = BFieldElement::ZERO;
+            for (size_t j = 0; j < Tip5Sponge::STATE_SIZE; j++) {
+                size_t k = (i + Tip5Sponge::STATE_SIZE - j) % Tip5Sponge::STATE_SIZE;
+                acc += BFieldElement::new_element(Tip5Sponge::MDS_MATRIX_FIRST_COLUMN[k]) * input[j];
+            }
+            expected[i] = acc;
+        }
+
+        sponge.mds();
+        EXPECT_EQ(sponge.state(), expected);
+    }
+}
+
+// Like twenty-first's mds_generated the row sums are reduced only below 2^64,
+// so a raw word in [P, 2^64) is kept as is rather than canonicalized
+TEST(Tip5SpongeTest, MdsKeepsNonCanonicalRawOutput) {
+    uint64_t entry = Tip5Sponge::MDS_MATRIX_FIRST_COLUMN[0];
+    uint64_t raw = BFieldElement::P / entry + 1;
+    ASSERT_GE(entry * raw, BFieldElement::P);
+
+    Tip5Sponge sponge(Domain::VariableLength);
+    sponge.state().fill(BFieldElement::ZERO);
+    sponge.state()[0] = BFieldElement::from_raw_u64(raw);
+    sponge.mds();
+    EXPECT_EQ(sponge.state()[0].raw_u64(), entry * raw);
+}
+
+TEST(Tip5SpongeTest, FixedLengthDomainSetsCapacityToOne) {
+    Tip5Sponge fixed(Domain::FixedLength);
+    Tip5Sponge variable = Tip5Sponge::init();
+
+    for (size_t i = 0; i < Tip5Sponge::STATE_SIZE; i++) {
+        EXPECT_TRUE(variable.state()[i].is_zero());
+        if (i < Tip5Sponge::RATE) {
+            EXPECT_TRUE(fixed.state()[i].is_zero());
+        } else {
+            EXPECT_TRUE(fixed.state()[i].is_one());
+        }
+    }
+}
+
+TEST(Tip5SpongeTest, HashPairEqualsHash10OfConcatenation) {
+    RandomGenerator rng(11);
+    Digest left = rng.random_digest();
+    Digest right = rng.random_digest();
+
+    Tip5Sponge::RateBlock input;
+    std::copy(left.values().begin(), left.values().end(), input.begin());
+    std::copy(right.values().begin(), right.values().end(), input.begin() + Digest::LEN);
+
+    EXPECT_EQ(Tip5Sponge::hash_pair(left, right), Tip5Sponge::hash_10(input));
+    EXPECT_NE(Tip5Sponge::hash_pair(left, right), Tip5Sponge::hash_pair(right, left));
+}
+
+TEST(Tip5SpongeTest, HashVarlenPaddingDistinguishesTrailingZeros) {
+    std::vector<BFieldElement> input = {bfe(1), bfe(2), bfe(3)};
+    std::vector<BFieldElement> padded = input;
+    padded.push_back(BFieldElement::ZERO);
+
+    EXPECT_NE(Tip5Sponge::hash_varlen(input), Tip5Sponge::hash_varlen(padded));
+    EXPECT_NE(Tip5Sponge::hash_varlen({}), Tip5Sponge::hash_varlen({BFieldElement::ZERO}));
+}
+
+TEST(Tip5SpongeTest, HashVarlenMatchesManualSponge) {
+    RandomGenerator rng(13);
+    for (size_t length : {0u, 1u, 9u, 10u, 11u, 25u}) {
+        std::vector<BFieldElement> input = rng.random_elements(length);
+
+        Tip5Sponge sponge = Tip5Sponge::init();
+        size_t offset = 0;
+        for (; offset + Tip5Sponge::RATE <= length; offset += Tip5Sponge::RATE) {
+            Tip5Sponge::RateBlock chunk;
+            std::copy(input.begin() + offset, input.begin() + offset + Tip5Sponge::RATE, chunk.begin());
+            sponge.absorb(chunk);
+        }
+        Tip5Sponge::RateBlock last;
+        last.fill(BFieldElement::ZERO);
+        std::copy(input.begin() + offset, input.end(), last.begin());
+        last[length - offset] = BFieldElement::ONE;
+        sponge.absorb(last);
+        Tip5Sponge::RateBlock produce = sponge.squeeze();
+
+        Digest::Values values;
+        std::copy(produce.begin(), produce.begin() + Digest::LEN, values.begin());
+        EXPECT_EQ(Tip5Sponge::hash_varlen(input), Digest(values)) << "Failed for length " << length;
+    }
+}
+
+TEST(Tip5SpongeTest, DigestToStringSeparatesElementsWithCommas) {
+    Digest digest(Digest::Values{bfe(0), bfe(1), bfe(2), bfe(3), bfe(4)});
+    EXPECT_EQ(digest.to_string(), "0,1,2,3,4");
+}
+
+TEST(Tip5SpongeTest, HashPairsMatchesHashPair) {
+    RandomGenerator rng(17);
+    // Cover an empty batch, a partial lane group and several full groups
+    for (size_t n : {0u, 1u, 7u, 8u, 9u, 33u}) {
+        std::vector<Digest> lefts;
+        std::vector<Digest> rights;
+        for (size_t i = 0; i < n; i++) {
+            lefts.push_back(rng.random_digest());
+            rights.push_back(rng.random_digest());
+        }
+
+        std::vector<Digest> out(n);
+        Tip5Sponge::hash_pairs(lefts, rights, out);
+
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_EQ(out[i], Tip5Sponge::hash_pair(lefts[i], rights[i])) << "Failed for pair " << i << " of " << n;
+        }
+    }
+}
+
+TEST(Tip5SpongeTest, HashPairsRejectsMismatchedLengths) {
+    std::vector<Digest> lefts(3);
+    std::vector<Digest> rights(2);
+    std::vector<Digest> out(3);
+    EXPECT_THROW(Tip5Sponge::hash_pairs(lefts, rights, out), std::invalid_argument);
+}
+
+TEST(Tip5SpongeTest, HashLayerHashesAdjacentDigests) {
+    RandomGenerator rng(19);
+    std::vector<Digest> children;
+    for (size_t i = 0; i < 22; i++) {
+        children.push_back(rng.random_digest());
+    }
+
+    std::vector<Digest> parents(11);
+    Tip5Sponge::hash_layer(children, parents);
+    for (size_t i = 0; i < parents.size(); i++) {
+        EXPECT_EQ(parents[i], Tip5Sponge::hash_pair(children[2 * i], children[2 * i + 1]));
+    }
+
+    std::vector<Digest> wrong(10);
+    EXPECT_THROW(Tip5Sponge::hash_layer(children, wrong), std::invalid_argument);
+}
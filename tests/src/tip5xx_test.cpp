@@ -80,3 +80,93 @@ TEST(Tip5HashTest, HashVarlenHandlesMultipleInputs) {
     EXPECT_EQ(result.size(), 32);
     EXPECT_NE(result, std::vector<uint8_t>(32, 0));
 }
+
+TEST(Tip5HashTest, HashPairIntoArrayMatchesVectorResult) {
+    auto left = make_test_vector({1, 2, 3, 4});
+    auto right = make_test_vector({5, 6, 7, 8});
+
+    tip5xx::Tip5::Hash hash;
+    tip5xx::Tip5::hash_pair(left, right, hash);
+
+    auto expected = tip5xx::Tip5::hash_pair(left, right);
+    EXPECT_EQ(std::vector<uint8_t>(hash.begin(), hash.end()), expected);
+}
+
+TEST(Tip5HashTest, PermuteStateIsDeterministic) {
+    tip5xx::Tip5::State a{};
+    tip5xx::Tip5::State b{};
+    a[0] = b[0] = 0x42;
+
+    tip5xx::Tip5::permute(a);
+    tip5xx::Tip5::permute(b);
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, tip5xx::Tip5::State{});
+}
+
+TEST(Tip5HashTest, HashVarlenSpongeSeparatesInputBoundaries) {
+    auto ab = make_test_vector({'a', 'b'});
+    auto c = make_test_vector({'c'});
+    auto a = make_test_vector({'a'});
+    auto bc = make_test_vector({'b', 'c'});
+
+    std::vector<tip5xx::span<const uint8_t>> first = {ab, c};
+    std::vector<tip5xx::span<const uint8_t>> second = {a, bc};
+    EXPECT_NE(tip5xx::Tip5::hash_varlen_sponge(first), tip5xx::Tip5::hash_varlen_sponge(second));
+
+    std::vector<tip5xx::span<const uint8_t>> none;
+    std::vector<uint8_t> empty;
+    std::vector<tip5xx::span<const uint8_t>> one_empty = {empty};
+    EXPECT_NE(tip5xx::Tip5::hash_varlen_sponge(none), tip5xx::Tip5::hash_varlen_sponge(one_empty));
+}
+
+TEST(Tip5HashTest, HashVarlenSpongeIteratorMatchesSpan) {
+    std::vector<std::vector<uint8_t>> inputs;
+    for (uint8_t i = 0; i < 20; i++) {
+        // Lengths around the 31-byte rate
+        inputs.push_back(std::vector<uint8_t>(static_cast<size_t>(i) * 3, i));
+    }
+
+    std::vector<tip5xx::span<const uint8_t>> views(inputs.begin(), inputs.end());
+    auto from_span = tip5xx::Tip5::hash_varlen_sponge(views);
+    auto from_iterators = tip5xx::Tip5::hash_varlen_sponge(inputs.begin(), inputs.end());
+
+    EXPECT_EQ(from_span, from_iterators);
+    EXPECT_NE(std::vector<uint8_t>(from_span.begin(), from_span.end()), tip5xx::Tip5::hash_varlen(inputs));
+}
+
+TEST(Tip5HashTest, HashPairOverViewsMatchesVectorResult) {
+    std::array<uint8_t, 4> left = {1, 2, 3, 4};
+    const uint8_t right[] = {5, 6, 7, 8, 9};
+    auto expected = tip5xx::Tip5::hash_pair(std::vector<uint8_t>(left.begin(), left.end()),
+                                            std::vector<uint8_t>(std::begin(right), std::end(right)));
+
+    tip5xx::Tip5::Hash from_spans;
+    tip5xx::Tip5::hash_pair(left, right, from_spans);
+    EXPECT_EQ(std::vector<uint8_t>(from_spans.begin(), from_spans.end()), expected);
+
+    tip5xx::Tip5::Hash from_pointers;
+    tip5xx::Tip5::hash_pair(left.data(), left.size(), right, sizeof(right), from_pointers);
+    EXPECT_EQ(from_pointers, from_spans);
+
+    // The output may alias an input
+    tip5xx::Tip5::Hash chained = from_spans;
+    tip5xx::Tip5::hash_pair(chained, right, chained);
+    tip5xx::Tip5::Hash reference;
+    tip5xx::Tip5::hash_pair(from_spans, right, reference);
+    EXPECT_EQ(chained, reference);
+}
+
+TEST(Tip5HashTest, HashVarlenOverViewsMatchesVectorResult) {
+    std::vector<std::vector<uint8_t>> inputs = {make_test_vector({1, 2}), make_test_vector({3}), make_test_vector({4, 5, 6})};
+    std::vector<tip5xx::span<const uint8_t>> views(inputs.begin(), inputs.end());
+
+    tip5xx::Tip5::Hash hash;
+    tip5xx::Tip5::hash_varlen(views, hash);
+    auto expected = tip5xx::Tip5::hash_varlen(inputs);
+    EXPECT_EQ(std::vector<uint8_t>(hash.begin(), hash.end()), expected);
+
+    std::vector<tip5xx::span<const uint8_t>> none;
+    tip5xx::Tip5::hash_varlen(none, hash);
+    EXPECT_EQ(hash, tip5xx::Tip5::Hash{});
+}
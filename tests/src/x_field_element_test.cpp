@@ -0,0 +1,184 @@
+// Copyright (c) 2025 Maxim [maxirmx] Samsonov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// This file is a part of tip5xx library
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "tip5xx/x_field_element.hpp"
+#include "random_generator.hpp"
+
+using namespace tip5xx;
+
+namespace {
+
+XFieldElement random_xfe(RandomGenerator& rng) {
+    return XFieldElement(XFieldElement::Coefficients{rng.random_bfe(), rng.random_bfe(), rng.random_bfe()});
+}
+
+// Schoolbook product reduced modulo X³ - X + 1, as a reference for Karatsuba
+XFieldElement schoolbook_mul(const XFieldElement& a, const XFieldElement& b) {
+    std::array<BFieldElement, 5> d{};
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            d[i + j] += a[i] * b[j];
+        }
+    }
+    // X⁴ = X² - X, X³ = X - 1
+    d[2] += d[4];
+    d[1] -= d[4];
+    d[1] += d[3];
+    d[0] -= d[3];
+    return XFieldElement(XFieldElement::Coefficients{d[0], d[1], d[2]});
+}
+
+} // namespace
+
+TEST(XFieldElementTest, ShahPolynomialReduction) {
+    XFieldElement x = xfe(0, 1, 0);
+    XFieldElement x_squared = xfe(0, 0, 1);
+    EXPECT_EQ(x * x, x_squared);
+    // X³ = X - 1
+    EXPECT_EQ(x * x_squared, xfe(BFieldElement::MAX, 1, 0));
+}
+
+TEST(XFieldElementTest, KaratsubaMatchesSchoolbook) {
+    RandomGenerator rng(81);
+    for (int i = 0; i < 100; i++) {
+        XFieldElement a = random_xfe(rng);
+        XFieldElement b = random_xfe(rng);
+        EXPECT_EQ(a * b, schoolbook_mul(a, b));
+        EXPECT_EQ(a * b, b * a);
+    }
+}
+
+TEST(XFieldElementTest, FieldAxioms) {
+    RandomGenerator rng(82);
+    for (int i = 0; i < 50; i++) {
+        XFieldElement a = random_xfe(rng);
+        XFieldElement b = random_xfe(rng);
+        XFieldElement c = random_xfe(rng);
+        EXPECT_EQ(a * (b + c), a * b + a * c);
+        EXPECT_EQ((a * b) * c, a * (b * c));
+        EXPECT_EQ(a - a, XFieldElement::ZERO);
+        EXPECT_EQ(a + (-a), XFieldElement::ZERO);
+        EXPECT_EQ(a * XFieldElement::ONE, a);
+    }
+}
+
+TEST(XFieldElementTest, InverseGivesIdentity) {
+    RandomGenerator rng(83);
+    for (int i = 0; i < 100; i++) {
+        XFieldElement a = random_xfe(rng);
+        EXPECT_TRUE((a * a.inverse()).is_one());
+        EXPECT_EQ((a / a), XFieldElement::ONE);
+    }
+
+    // Elements of the base field invert like base field elements
+    XFieldElement seven = bfe(7).lift();
+    EXPECT_EQ(seven.inverse(), bfe(7).inverse().lift());
+}
+
+TEST(XFieldElementTest, InverseOfZero) {
+    EXPECT_THROW((void)XFieldElement::ZERO.inverse(), BFieldElementInverseError);
+    EXPECT_EQ(XFieldElement::ZERO.inverse_or_zero(), XFieldElement::ZERO);
+}
+
+TEST(XFieldElementTest, BatchInversion) {
+    RandomGenerator rng(84);
+    std::vector<XFieldElement> values(1000);
+    for (auto& v : values) {
+        v = random_xfe(rng);
+    }
+    values[17] = XFieldElement::ZERO;
+
+    std::vector<XFieldElement> inverses(values.size());
+    XFieldElement::batch_inversion_or_zero(values, inverses);
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(inverses[i], values[i].inverse_or_zero()) << "Failed at index " << i;
+    }
+
+    values[17] = XFieldElement::ONE;
+    std::vector<XFieldElement> by_value = XFieldElement::batch_inversion(values);
+    EXPECT_EQ(by_value[17], XFieldElement::ONE);
+    EXPECT_EQ(by_value[3], values[3].inverse());
+}
+
+TEST(XFieldElementTest, BaseFieldScalarMultiplication) {
+    RandomGenerator rng(85);
+    // Spans several blocks of the packed kernel, with a partial last block
+    std::vector<BFieldElement> scalars = rng.random_elements(600);
+    std::vector<XFieldElement> values(scalars.size());
+    for (auto& v : values) {
+        v = random_xfe(rng);
+    }
+
+    std::vector<XFieldElement> out(values.size());
+    XFieldElement::mul_by_bfe(scalars, values, out);
+    for (size_t i = 0; i < values.size(); i++) {
+        EXPECT_EQ(out[i], values[i] * scalars[i].lift());
+        EXPECT_EQ(out[i], scalars[i] * values[i]);
+    }
+
+    std::vector<XFieldElement> short_out(2);
+    EXPECT_THROW(XFieldElement::mul_by_bfe(scalars, values, short_out), std::invalid_argument);
+}
+
+TEST(XFieldElementTest, LiftAndUnlift) {
+    BFieldElement b = bfe(12345);
+    XFieldElement lifted = b.lift();
+    ASSERT_TRUE(lifted.unlift().has_value());
+    EXPECT_EQ(*lifted.unlift(), b);
+    EXPECT_FALSE(xfe(1, 2, 3).unlift().has_value());
+    EXPECT_EQ(lifted + b, (b + b).lift());
+}
+
+TEST(XFieldElementTest, ModPowAndPrimitiveRoots) {
+    RandomGenerator rng(86);
+    XFieldElement a = random_xfe(rng);
+    EXPECT_EQ(a.mod_pow(0), XFieldElement::ONE);
+    EXPECT_EQ(a.mod_pow(5), a * a * a * a * a);
+    EXPECT_EQ(a.mod_pow_u32(3), a * a * a);
+
+    XFieldElement root = XFieldElement::primitive_root_of_unity(8);
+    EXPECT_TRUE(root.mod_pow(8).is_one());
+    EXPECT_FALSE(root.mod_pow(4).is_one());
+    EXPECT_EQ(root.cyclic_group_elements().size(), 8u);
+
+    std::vector<XFieldElement> coset = root.cyclic_group_elements_of_order(8, a);
+    ASSERT_EQ(coset.size(), 8u);
+    for (size_t i = 0; i < coset.size(); i++) {
+        EXPECT_EQ(coset[i], a * root.mod_pow(i));
+    }
+    EXPECT_THROW(root.cyclic_group_elements_of_order(4), std::invalid_argument);
+}
+
+TEST(XFieldElementTest, FromCoefficientsAndToString) {
+    std::vector<BFieldElement> coefficients = {bfe(1), bfe(2), bfe(3)};
+    XFieldElement a = XFieldElement::from_coefficients(coefficients);
+    EXPECT_EQ(a, xfe(1, 2, 3));
+    EXPECT_EQ(a.to_string(), "(" + bfe(3).to_string() + "·x² + " + bfe(2).to_string() + "·x + " +
+                             bfe(1).to_string() + ")");
+    EXPECT_EQ(bfe(5).lift().to_string(), bfe(5).to_string() + "_xfe");
+
+    std::vector<BFieldElement> too_short = {bfe(1)};
+    EXPECT_THROW(XFieldElement::from_coefficients(too_short), std::invalid_argument);
+}